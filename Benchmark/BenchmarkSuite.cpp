@@ -0,0 +1,117 @@
+#include "BenchmarkSuite.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace MosaicGame::Benchmark {
+
+    void BenchmarkSuite::add(const std::string &name, Scenario scenario) {
+        this->_scenarios.emplace_back(name, std::move(scenario));
+    }
+
+    std::vector<BenchmarkResult> BenchmarkSuite::run(const BenchmarkOptions &options) const {
+        std::vector<BenchmarkResult> results = {};
+        for (const auto &[name, scenario]: this->_scenarios) {
+            if (name.find(options.filter) != std::string::npos) {
+                results.emplace_back(BenchmarkSuite::measure(name, scenario, options));
+            }
+        }
+        return results;
+    }
+
+    BenchmarkResult BenchmarkSuite::measure(const std::string &name, const Scenario &scenario,
+                                            const BenchmarkOptions &options) {
+        using Clock = std::chrono::steady_clock;
+
+        std::size_t iterations = 1;
+        while (true) {
+            auto start = Clock::now();
+            scenario(iterations);
+            if (Clock::now() - start >= options.minimumSampleTime || iterations >= (1ULL << 40)) {
+                break;
+            }
+            iterations *= 2;
+        }
+
+        std::vector<double> samples = {};
+        samples.reserve(options.samples);
+        for (std::size_t sample = 0; sample < options.warmupSamples + options.samples; sample++) {
+            auto start = Clock::now();
+            scenario(iterations);
+            auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            if (sample >= options.warmupSamples) {
+                samples.emplace_back(elapsed / iterations);
+            }
+        }
+        if (samples.empty()) {
+            throw std::runtime_error("At least one sample is required.");
+        }
+
+        std::sort(samples.begin(), samples.end());
+        auto percentile = [&samples](double fraction) {
+            return samples[std::min(samples.size() - 1, (std::size_t) (fraction * (samples.size() - 1) + 0.5))];
+        };
+        return {
+                name,
+                iterations,
+                percentile(0.5),
+                percentile(0.99),
+                std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size(),
+                samples.front(),
+        };
+    }
+
+    std::string BenchmarkSuite::toJson(const std::vector<BenchmarkResult> &results) {
+        std::ostringstream json;
+        json << std::fixed << std::setprecision(3) << "{\n  \"unit\": \"ns/iteration\",\n  \"scenarios\": [\n";
+        for (std::size_t i = 0; i < results.size(); i++) {
+            const auto &result = results[i];
+            json << "    {\"name\": \"" << result.name << "\", \"iterations\": " << result.iterations
+                 << ", \"median\": " << result.median << ", \"p99\": " << result.p99
+                 << ", \"mean\": " << result.mean << ", \"min\": " << result.minimum << "}"
+                 << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        json << "  ]\n}\n";
+        return json.str();
+    }
+
+    std::map<std::string, double> BenchmarkSuite::readBaseline(const std::string &path) {
+        std::ifstream file(path);
+        if (!file) {
+            throw std::runtime_error("The baseline file cannot be opened.");
+        }
+        std::map<std::string, double> medians = {};
+        std::string line;
+        while (std::getline(file, line)) {
+            auto name = line.find("\"name\": \"");
+            auto median = line.find("\"median\": ");
+            if (name == std::string::npos || median == std::string::npos) {
+                continue;
+            }
+            name += 9;
+            medians[line.substr(name, line.find('"', name) - name)] = std::stod(line.substr(median + 10));
+        }
+        return medians;
+    }
+
+    bool BenchmarkSuite::pinToCpu(unsigned int cpu) {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+        (void) cpu;
+        return false;
+#endif
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef MOSAICGAME_BENCHMARKSUITE_H
+#define MOSAICGAME_BENCHMARKSUITE_H
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace MosaicGame::Benchmark {
+    // Keeps the compiler from discarding a value computed only to be measured.
+    template<class T>
+    inline void doNotOptimize(const T &value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    struct BenchmarkOptions {
+        std::size_t warmupSamples = 3;
+        std::size_t samples = 25;
+        // Each sample repeats the scenario until it takes at least this long.
+        std::chrono::nanoseconds minimumSampleTime = std::chrono::milliseconds(2);
+        // Only scenarios whose name contains this run.
+        std::string filter;
+    };
+
+    struct BenchmarkResult {
+        std::string name;
+        std::size_t iterations;
+        double median;
+        double p99;
+        double mean;
+        double minimum;
+    };
+
+    // Named micro-benchmarks timed with steady_clock. Timings are nanoseconds per iteration; every
+    // sample runs the same calibrated iteration count so the samples are comparable.
+    class BenchmarkSuite {
+    public:
+        using Scenario = std::function<void(std::size_t iterations)>;
+
+        void add(const std::string &name, Scenario scenario);
+
+        [[nodiscard]] std::vector<BenchmarkResult> run(const BenchmarkOptions &options) const;
+
+        [[nodiscard]] static std::string toJson(const std::vector<BenchmarkResult> &results);
+
+        // Reads the median of every scenario from JSON written by toJson().
+        [[nodiscard]] static std::map<std::string, double> readBaseline(const std::string &path);
+
+        // Pins the calling thread to one CPU; returns false where that is unsupported or fails.
+        static bool pinToCpu(unsigned int cpu);
+
+    private:
+        std::vector<std::pair<std::string, Scenario>> _scenarios;
+
+        [[nodiscard]] static BenchmarkResult measure(const std::string &name, const Scenario &scenario,
+                                                     const BenchmarkOptions &options);
+    };
+}
+
+#endif //MOSAICGAME_BENCHMARKSUITE_H
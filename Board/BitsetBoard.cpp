@@ -1,8 +1,10 @@
+#include <array>
 #include <bitset>
-#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "BitsetBoard.h"
+#include "../Instrumentation/Instrumentation.h"
 
 namespace MosaicGame::Board {
 
@@ -31,31 +33,35 @@ namespace MosaicGame::Board {
         return BitsetBoard(size);
     }
 
-    std::unordered_map<unsigned char, std::shared_ptr<BitsetBoard>> BitsetBoard::_neutralBoards = {};
-
     BitsetBoard BitsetBoard::neutralBoard(unsigned char size) {
-        if (!BitsetBoard::_neutralBoards.count(size)) {
-            if (size % 2 == 1) {
-                auto bitset = std::bitset<140>(1);
-                for (auto i = 1; i < size; i++) {
-                    bitset <<= (i * i);
+        static const auto neutralBoards = [] {
+            std::vector<BitsetBoard> neutralBoards = {};
+            for (unsigned char size = 0; size <= BitsetBoard::MaxSize; size++) {
+                if (size % 2 == 1) {
+                    auto bitset = std::bitset<140>(1);
+                    for (auto i = 1; i < size; i++) {
+                        bitset <<= (i * i);
+                    }
+                    bitset <<= (size * size / 2);
+                    neutralBoards.emplace_back(size, bitset);
+                } else {
+                    neutralBoards.emplace_back(size);
                 }
-                bitset <<= (size * size / 2);
-                BitsetBoard::_neutralBoards[size] = std::make_shared<BitsetBoard>(size, bitset);
-            } else {
-                BitsetBoard::_neutralBoards[size] = std::make_shared<BitsetBoard>(size);
             }
-        }
-        return *BitsetBoard::_neutralBoards[size];
+            return neutralBoards;
+        }();
+        return neutralBoards.at(size);
     }
 
-    std::unordered_map<unsigned char, std::shared_ptr<BitsetBoard>> BitsetBoard::_groundBoards = {};
-
     BitsetBoard BitsetBoard::groundBoard(unsigned char size) {
-        if (!BitsetBoard::_groundBoards.count(size)) {
-            BitsetBoard::_groundBoards[size] = std::make_shared<BitsetBoard>(size, BitsetBoard::layerMask(size));
-        }
-        return *BitsetBoard::_groundBoards[size];
+        static const auto groundBoards = [] {
+            std::vector<BitsetBoard> groundBoards = {};
+            for (unsigned char size = 0; size <= BitsetBoard::MaxSize; size++) {
+                groundBoards.emplace_back(size, BitsetBoard::layerMask(size));
+            }
+            return groundBoards;
+        }();
+        return groundBoards.at(size);
     }
 
     unsigned int BitsetBoard::size() const {
@@ -79,6 +85,19 @@ namespace MosaicGame::Board {
         return this->_bitset.count();
     }
 
+    std::bitset<140> BitsetBoard::bitset() const {
+        return this->_bitset;
+    }
+
+    std::array<std::uint64_t, BitsetBoard::WordCount> BitsetBoard::words() const {
+        const auto mask = std::bitset<140>(~0ULL);
+        return {
+                (this->_bitset & mask).to_ullong(),
+                ((this->_bitset >> 64) & mask).to_ullong(),
+                (this->_bitset >> 128).to_ullong(),
+        };
+    }
+
     std::unordered_map<short, std::bitset<140>> BitsetBoard::_mirrorHorizontalMasks = {
             {0, std::bitset<140>("10000001000000100000010000001000000100000010000000000000000000000000000000000000000010000100001000010000100000000000000000001001001000001")},
             {1, std::bitset<140>("10000010000010000010000010000010000000000000000000000000000010001000100010000000000010100")},
@@ -246,6 +265,8 @@ namespace MosaicGame::Board {
     }
 
     BitsetBoard BitsetBoard::promote(const BitsetBoard::PromoteType promoteType) const {
+        MOSAICGAME_COUNT(PromoteCalls, 1);
+        MOSAICGAME_TIME(PromoteNanoseconds);
         auto result = BitsetBoard::emptyBoard(this->_size);
         for (auto srcLayerSize = this->_size; srcLayerSize > 1; srcLayerSize--) {
             unsigned int dstLayerSize = srcLayerSize - 1;
@@ -378,16 +399,14 @@ namespace MosaicGame::Board {
         return result;
     }
 
-    std::unordered_map<unsigned char, std::bitset<140>> BitsetBoard::_boardMasks = {};
-
     std::bitset<140> BitsetBoard::boardMask(unsigned char size) {
-        if (BitsetBoard::_boardMasks.count(size) < 1) {
-            auto bitset = std::bitset<140>(0);
-            for (unsigned int i = 1; i <= size; i++) {
-                bitset |= BitsetBoard::layerMask(i);
+        static const auto boardMasks = [] {
+            std::array<std::bitset<140>, BitsetBoard::MaxSize + 1> boardMasks = {};
+            for (unsigned int size = 1; size <= BitsetBoard::MaxSize; size++) {
+                boardMasks[size] = boardMasks[size - 1] | BitsetBoard::layerMask(size);
             }
-            BitsetBoard::_boardMasks[size] = bitset;
-        }
-        return BitsetBoard::_boardMasks[size];
+            return boardMasks;
+        }();
+        return boardMasks.at(size);
     }
 }
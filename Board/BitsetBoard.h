@@ -1,14 +1,21 @@
 #ifndef MOSAICGAME_BITSETBOARD_H
 #define MOSAICGAME_BITSETBOARD_H
 
+#include <array>
 #include <bitset>
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include "Board.h"
+#include "CellGeometry.h"
 
 namespace MosaicGame::Board {
-    class BitsetBoard : public Board<BitsetBoard> {
+    class BitsetBoard {
     public:
+        static constexpr unsigned char MaxSize = 7;
+
+        static constexpr unsigned int WordCount = 3;
+
         explicit BitsetBoard(unsigned char size, const std::bitset<140> &bitset);
 
         explicit BitsetBoard(unsigned int size, const std::string &bitsetString);
@@ -21,62 +28,64 @@ namespace MosaicGame::Board {
 
         static BitsetBoard neutralBoard(unsigned char size);
 
-        [[nodiscard]] unsigned int size() const override;
+        [[nodiscard]] unsigned int size() const;
+
+        [[nodiscard]] std::string toString() const;
 
-        [[nodiscard]] std::string toString() const override;
+        [[nodiscard]] unsigned int count() const;
 
-        [[nodiscard]] unsigned int count() const override;
+        [[nodiscard]] std::bitset<140> bitset() const;
 
-        [[nodiscard]] BitsetBoard mirrorHorizontal() const override;
+        // Packs the board into 64-bit words, least significant word first.
+        [[nodiscard]] std::array<std::uint64_t, WordCount> words() const;
 
-        [[nodiscard]] BitsetBoard flipVertical() const override;
+        [[nodiscard]] BitsetBoard mirrorHorizontal() const;
 
-        [[nodiscard]] BitsetBoard flipDiagonal() const override;
+        [[nodiscard]] BitsetBoard flipVertical() const;
 
-        [[nodiscard]] BitsetBoard rotate90() const override;
+        [[nodiscard]] BitsetBoard flipDiagonal() const;
 
-        [[nodiscard]] BitsetBoard rotate180() const override;
+        [[nodiscard]] BitsetBoard rotate90() const;
 
-        [[nodiscard]] BitsetBoard rotate270() const override;
+        [[nodiscard]] BitsetBoard rotate180() const;
 
-        [[nodiscard]] bool operator==(const BitsetBoard &other) const override;
+        [[nodiscard]] BitsetBoard rotate270() const;
 
-        [[nodiscard]] BitsetBoard operator&(const BitsetBoard &other) const override;
+        [[nodiscard]] bool operator==(const BitsetBoard &other) const;
 
-        [[nodiscard]] BitsetBoard operator|(const BitsetBoard &other) const override;
+        [[nodiscard]] BitsetBoard operator&(const BitsetBoard &other) const;
 
-        [[nodiscard]] BitsetBoard operator^(const BitsetBoard &other) const override;
+        [[nodiscard]] BitsetBoard operator|(const BitsetBoard &other) const;
 
-        [[nodiscard]] BitsetBoard operator<<(unsigned int amount) const override;
+        [[nodiscard]] BitsetBoard operator^(const BitsetBoard &other) const;
 
-        [[nodiscard]] BitsetBoard operator>>(unsigned int amount) const override;
+        [[nodiscard]] BitsetBoard operator<<(unsigned int amount) const;
 
-        [[nodiscard]] BitsetBoard flip() const override;
+        [[nodiscard]] BitsetBoard operator>>(unsigned int amount) const;
 
-        [[nodiscard]] BitsetBoard promoteZero() const override;
+        [[nodiscard]] BitsetBoard flip() const;
 
-        [[nodiscard]] BitsetBoard promoteOne() const override;
+        [[nodiscard]] BitsetBoard promoteZero() const;
 
-        [[nodiscard]] BitsetBoard promoteTwo() const override;
+        [[nodiscard]] BitsetBoard promoteOne() const;
 
-        [[nodiscard]] BitsetBoard promoteThree() const override;
+        [[nodiscard]] BitsetBoard promoteTwo() const;
 
-        [[nodiscard]] BitsetBoard promoteFour() const override;
+        [[nodiscard]] BitsetBoard promoteThree() const;
 
-        [[nodiscard]] BitsetBoard promoteHalfOrMore() const override;
+        [[nodiscard]] BitsetBoard promoteFour() const;
 
-        [[nodiscard]] BitsetBoard promoteMajority() const override;
+        [[nodiscard]] BitsetBoard promoteHalfOrMore() const;
+
+        [[nodiscard]] BitsetBoard promoteMajority() const;
 
     private:
         unsigned char _size;
         unsigned int _bitSize;
         std::bitset<140> _bitset;
-        static std::unordered_map<unsigned char, std::shared_ptr<BitsetBoard>> _neutralBoards;
-        static std::unordered_map<unsigned char, std::shared_ptr<BitsetBoard>> _groundBoards;
         static std::unordered_map<short, std::bitset<140>> _mirrorHorizontalMasks;
         static std::unordered_map<short, std::bitset<140>> _flipVerticalMasks;
         static std::unordered_map<short, std::bitset<140>> _flipDiagonalMasks;
-        static std::unordered_map<unsigned char, std::bitset<140>> _boardMasks;
 
         enum PromoteType : unsigned int {
             Zero = 0b0000001,
@@ -100,6 +109,10 @@ namespace MosaicGame::Board {
 
         static std::bitset<140> boardMask(unsigned char size);
     };
+
+    static_assert(Board<BitsetBoard>);
+
+    using BitsetCellGeometry = CellGeometry<BitsetBoard::MaxSize>;
 }
 
 #endif //MOSAICGAME_BITSETBOARD_H
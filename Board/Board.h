@@ -1,57 +1,38 @@
 #ifndef MOSAICGAME_BOARD_H
 #define MOSAICGAME_BOARD_H
 
-#include<memory>
+#include <concepts>
+#include <string>
 
 namespace MosaicGame::Board {
+    // A pyramid board as a value type: every operation returns a new board of the same size. Checked at
+    // compile time, so callers templated on a board inline its bit operations instead of dispatching
+    // through a vtable.
     template<class T>
-    class Board {
-    public:
-        [[nodiscard]] virtual unsigned int size() const = 0;
-
-        [[nodiscard]] virtual std::string toString() const = 0;
-
-        [[nodiscard]] virtual unsigned int count() const = 0;
-
-        [[nodiscard]] virtual T mirrorHorizontal() const = 0;
-
-        [[nodiscard]] virtual T flipVertical() const = 0;
-
-        [[nodiscard]] virtual T flipDiagonal() const = 0;
-
-        [[nodiscard]] virtual T rotate90() const = 0;
-
-        [[nodiscard]] virtual T rotate180() const = 0;
-
-        [[nodiscard]] virtual T rotate270() const = 0;
-
-        [[nodiscard]] virtual T promoteZero() const = 0;
-
-        [[nodiscard]] virtual T promoteOne() const = 0;
-
-        [[nodiscard]] virtual T promoteTwo() const = 0;
-
-        [[nodiscard]] virtual T promoteThree() const = 0;
-
-        [[nodiscard]] virtual T promoteFour() const = 0;
-
-        [[nodiscard]] virtual T promoteHalfOrMore() const = 0;
-
-        [[nodiscard]] virtual T promoteMajority() const = 0;
-
-        [[nodiscard]] virtual bool operator==(const T &other) const = 0;
-
-        [[nodiscard]] virtual T operator&(const T &other) const = 0;
-
-        [[nodiscard]] virtual T operator|(const T &other) const = 0;
-
-        [[nodiscard]] virtual T operator^(const T &other) const = 0;
-
-        [[nodiscard]] virtual T operator<<(unsigned int amount) const = 0;
-
-        [[nodiscard]] virtual T operator>>(unsigned int amount) const = 0;
-
-        [[nodiscard]] virtual T flip() const = 0;
+    concept Board = std::copyable<T> && requires(const T board, unsigned int amount) {
+        { board.size() } -> std::convertible_to<unsigned int>;
+        { board.toString() } -> std::same_as<std::string>;
+        { board.count() } -> std::convertible_to<unsigned int>;
+        { board.mirrorHorizontal() } -> std::same_as<T>;
+        { board.flipVertical() } -> std::same_as<T>;
+        { board.flipDiagonal() } -> std::same_as<T>;
+        { board.rotate90() } -> std::same_as<T>;
+        { board.rotate180() } -> std::same_as<T>;
+        { board.rotate270() } -> std::same_as<T>;
+        { board.promoteZero() } -> std::same_as<T>;
+        { board.promoteOne() } -> std::same_as<T>;
+        { board.promoteTwo() } -> std::same_as<T>;
+        { board.promoteThree() } -> std::same_as<T>;
+        { board.promoteFour() } -> std::same_as<T>;
+        { board.promoteHalfOrMore() } -> std::same_as<T>;
+        { board.promoteMajority() } -> std::same_as<T>;
+        { board == board } -> std::same_as<bool>;
+        { board & board } -> std::same_as<T>;
+        { board | board } -> std::same_as<T>;
+        { board ^ board } -> std::same_as<T>;
+        { board << amount } -> std::same_as<T>;
+        { board >> amount } -> std::same_as<T>;
+        { board.flip() } -> std::same_as<T>;
     };
 }
 
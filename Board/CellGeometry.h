@@ -0,0 +1,134 @@
+#ifndef MOSAICGAME_CELLGEOMETRY_H
+#define MOSAICGAME_CELLGEOMETRY_H
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+namespace MosaicGame::Board {
+    // Cells on a pyramid of the given size: 1 + 4 + ... + size * size.
+    constexpr unsigned int pyramidCells(unsigned int size) {
+        return size * (size + 1) * (2 * size + 1) / 6;
+    }
+
+    // 64-bit words needed for a pyramid of the given size.
+    constexpr unsigned int pyramidWords(unsigned int size) {
+        return (pyramidCells(size) + 63) / 64;
+    }
+
+    // Layer 0 is the apex and layer k is k + 1 cells wide, so the ground of a pyramid of size s is layer s - 1.
+    struct CellCoordinate {
+        unsigned char layer;
+        unsigned char row;
+        unsigned char column;
+    };
+
+    constexpr bool pyramidContains(unsigned int size, const CellCoordinate &coordinate) {
+        return coordinate.layer < size && coordinate.row <= coordinate.layer && coordinate.column <= coordinate.layer;
+    }
+
+    // Layers sit at fixed offsets whatever the board size, so the conversions do not need the size.
+    constexpr unsigned int coordinateToOffset(const CellCoordinate &coordinate) {
+        return pyramidCells(coordinate.layer) + coordinate.row * (coordinate.layer + 1) + coordinate.column;
+    }
+
+    constexpr CellCoordinate offsetToCoordinate(unsigned int offset) {
+        unsigned int layer = 0;
+        while (pyramidCells(layer + 1) <= offset) {
+            layer++;
+        }
+        auto index = offset - pyramidCells(layer);
+        return CellCoordinate{
+                (unsigned char) layer,
+                (unsigned char) (index / (layer + 1)),
+                (unsigned char) (index % (layer + 1)),
+        };
+    }
+
+    // Per-cell tables for every pyramid up to MAX_SIZE, built at compile time, so the coordinates of an offset
+    // and the cells around it are single lookups instead of layer loops and shifted whole-board masks. The
+    // layout does not change with the size; only the ground does, as a cell in the bottom layer of its pyramid
+    // rests on nothing. The functions taking a size account for that.
+    template<unsigned char MAX_SIZE>
+    class CellGeometry {
+    public:
+        static constexpr unsigned char MaxSize = MAX_SIZE;
+
+        static constexpr unsigned int CellCount = pyramidCells(MAX_SIZE);
+
+        static constexpr unsigned int WordCount = pyramidWords(MAX_SIZE);
+
+        // Least significant word first, as BitsetBoard::words().
+        using Words = std::array<std::uint64_t, WordCount>;
+
+        struct Cell {
+            CellCoordinate coordinate;
+            unsigned char supportCount;
+            unsigned char parentCount;
+            // The cells below at (row..row+1, column..column+1), row-major. Cells of the bottom layer of the
+            // tables have none; for the others, supportCount is 4 unless the cell is on the ground of a size.
+            std::array<unsigned short, 4> supports;
+            // The cells above resting on this one, row-major: one to four, none on the apex.
+            std::array<unsigned short, 4> parents;
+            Words supportMask;
+            Words parentMask;
+        };
+
+        static constexpr const Cell &cell(unsigned int offset) {
+            if (offset >= CellCount) {
+                throw std::runtime_error("The offset is out of the board.");
+            }
+            return CellGeometry::Cells[offset];
+        }
+
+        static constexpr bool isGround(unsigned char size, unsigned int offset) {
+            return CellGeometry::cell(offset).coordinate.layer + 1 == size;
+        }
+
+        static constexpr unsigned int supportCount(unsigned char size, unsigned int offset) {
+            return CellGeometry::isGround(size, offset) ? 0 : CellGeometry::cell(offset).supportCount;
+        }
+
+    private:
+        static constexpr std::array<Cell, CellCount> Cells = [] {
+            std::array<Cell, CellCount> cells = {};
+            for (unsigned int offset = 0; offset < CellCount; offset++) {
+                auto &cell = cells[offset];
+                cell.coordinate = offsetToCoordinate(offset);
+                auto [layer, row, column] = cell.coordinate;
+                if (layer + 1 < MAX_SIZE) {
+                    for (unsigned int i = 0; i < 4; i++) {
+                        auto support = coordinateToOffset(CellCoordinate{
+                                (unsigned char) (layer + 1),
+                                (unsigned char) (row + i / 2),
+                                (unsigned char) (column + i % 2),
+                        });
+                        cell.supports[cell.supportCount++] = support;
+                        cell.supportMask[support / 64] |= std::uint64_t(1) << (support % 64);
+                    }
+                }
+                for (unsigned int i = 0; i < 4 && layer > 0; i++) {
+                    // The parent at (row - 1 + i / 2, column - 1 + i % 2) in the layer above, when it exists.
+                    if ((i / 2 == 0 && row == 0) || (i / 2 == 1 && row == layer)
+                        || (i % 2 == 0 && column == 0) || (i % 2 == 1 && column == layer)) {
+                        continue;
+                    }
+                    auto parent = coordinateToOffset(CellCoordinate{
+                            (unsigned char) (layer - 1),
+                            (unsigned char) (row - 1 + i / 2),
+                            (unsigned char) (column - 1 + i % 2),
+                    });
+                    cell.parents[cell.parentCount++] = parent;
+                    cell.parentMask[parent / 64] |= std::uint64_t(1) << (parent % 64);
+                }
+            }
+            return cells;
+        }();
+    };
+
+    static_assert(coordinateToOffset(offsetToCoordinate(139)) == 139);
+    static_assert(CellGeometry<7>::cell(0).supports[3] == 4);
+    static_assert(CellGeometry<7>::cell(5).parentCount == 1 && CellGeometry<7>::cell(9).parentCount == 4);
+}
+
+#endif //MOSAICGAME_CELLGEOMETRY_H
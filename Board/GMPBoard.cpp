@@ -1,5 +1,7 @@
+#include <array>
+#include <atomic>
 #include <gmpxx.h>
-#include <unordered_map>
+#include <mutex>
 
 #include "GMPBoard.h"
 
@@ -8,39 +10,67 @@ using MosaicGame::Board::GMPBoard;
 
 namespace MosaicGame::Board {
 
+    namespace {
+        // Intermediates of promote and the symmetries. Their limbs grow to the largest board seen on the
+        // thread and are then reused.
+        struct Scratch {
+            mpz_class layer;
+            mpz_class right;
+            mpz_class below;
+            mpz_class p1;
+            mpz_class p2;
+            mpz_class shifted;
+            mpz_class promotion;
+            mpz_class moved;
+        };
+
+        thread_local Scratch scratch = {};
+    }
+
     GMPBoard::GMPBoard(unsigned char size, const mpz_class &mpz) :
             _size(size),
-            _bitSize(GMPBoard::sizeToBitSize(size)),
-            _mpz(
-                    (mpz_scan1(mpz.get_mpz_t(), this->_bitSize) != -1)
-                    ? mpz & mpz_class(std::string(GMPBoard::sizeToBitSize(size), '1'), 2)
-                    : mpz
-            ) {}
+            _geometry(&GMPBoard::geometry(size)),
+            _mpz() {
+        mpz_and(this->_mpz.get_mpz_t(), mpz.get_mpz_t(), this->_geometry->boardMask.get_mpz_t());
+    }
 
     GMPBoard::GMPBoard(unsigned int size, const std::string &mpzString) :
             GMPBoard(size, mpz_class(mpzString, 2)) {}
 
-    GMPBoard::GMPBoard(unsigned int size) : GMPBoard(size, "0") {}
+    GMPBoard::GMPBoard(unsigned int size) : GMPBoard(&GMPBoard::geometry(size), size) {}
+
+    GMPBoard::GMPBoard(const Geometry *geometry, unsigned char size) :
+            _size(size),
+            _geometry(geometry),
+            _mpz() {
+        mpz_realloc2(this->_mpz.get_mpz_t(), geometry->bitSize);
+    }
 
     GMPBoard GMPBoard::emptyBoard(unsigned char size) {
         return GMPBoard(size);
     }
 
     GMPBoard GMPBoard::groundBoard(unsigned char size) {
-        return GMPBoard(size, GMPBoard::layerMaskMpz(size));
+        const auto &geometry = GMPBoard::geometry(size);
+        auto result = GMPBoard(&geometry, size);
+        result._mpz = geometry.layerMasks[size];
+        return result;
     }
 
     GMPBoard GMPBoard::neutralBoard(unsigned char size) {
-        if (size % 2 == 1) {
-            auto mpz = mpz_class(1);
-            for (auto i = 1; i < size; i++) {
-                mpz <<= (i * i);
-            }
-            mpz <<= (size * size / 2);
-            return GMPBoard(size, mpz);
-        } else {
-            return GMPBoard::emptyBoard(size);
+        const auto &geometry = GMPBoard::geometry(size);
+        auto result = GMPBoard(&geometry, size);
+        result._mpz = geometry.neutralMask;
+        return result;
+    }
+
+    GMPBoard GMPBoard::cellBoard(unsigned char size, unsigned int offset) {
+        const auto &geometry = GMPBoard::geometry(size);
+        auto result = GMPBoard(&geometry, size);
+        if (offset < geometry.bitSize) {
+            mpz_setbit(result._mpz.get_mpz_t(), offset);
         }
+        return result;
     }
 
     unsigned int GMPBoard::size() const {
@@ -48,14 +78,15 @@ namespace MosaicGame::Board {
     }
 
     std::string GMPBoard::toString() const {
+        auto bitSize = this->_geometry->bitSize;
         auto result = this->_mpz.get_str(2);
         auto length = result.length();
-        if (length > this->_bitSize) {
-            return result.substr(length - this->_bitSize);
-        } else if (length == this->_bitSize) {
+        if (length > bitSize) {
+            return result.substr(length - bitSize);
+        } else if (length == bitSize) {
             return result;
         } else {
-            result.insert(result.begin(), this->_bitSize - length, '0');
+            result.insert(result.begin(), bitSize - length, '0');
             return result;
         }
     }
@@ -64,130 +95,25 @@ namespace MosaicGame::Board {
         return mpz_popcount(this->_mpz.get_mpz_t());
     }
 
-    std::unordered_map<short, const mpz_class> GMPBoard::_mirrorHorizontalMasks = {
-            {0, mpz_class("10000001000000100000010000001000000100000010000000000000000000000000000000000000000010000100001000010000100000000000000000001001001000001", 2)},
-            {1, mpz_class("10000010000010000010000010000010000000000000000000000000000010001000100010000000000010100", 2)},
-            {-1, mpz_class("1000001000001000001000001000001000000000000000000000000000001000100010001000000000001010", 2)},
-            {2, mpz_class("100000010000001000000100000010000001000000100000000000000000000000000000000000000000100001000010000100001000000000000000000010010010000000", 2)},
-            {-2, mpz_class("1000000100000010000001000000100000010000001000000000000000000000000000000000000000001000010000100001000010000000000000000000100100100000", 2)},
-            {3, mpz_class("100000100000100000100000100000100000000000000000000000000000100010001000100000000000000000", 2)},
-            {-3, mpz_class("100000100000100000100000100000100000000000000000000000000000100010001000100000000000000", 2)},
-            {4, mpz_class("1000000100000010000001000000100000010000001000000000000000000000000000000000000000001000010000100001000010000000000000000000000000000000000", 2)},
-            {-4, mpz_class("100000010000001000000100000010000001000000100000000000000000000000000000000000000000100001000010000100001000000000000000000000000000000", 2)},
-            {5, mpz_class("1000001000001000001000001000001000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-5, mpz_class("10000010000010000010000010000010000000000000000000000000000000000000000000000000000000", 2)},
-            {6, mpz_class("10000001000000100000010000001000000100000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-6, mpz_class("10000001000000100000010000001000000100000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-    };
+    bool GMPBoard::test(unsigned int offset) const {
+        return mpz_tstbit(this->_mpz.get_mpz_t(), offset);
+    }
+
+    long GMPBoard::scan(unsigned int offset) const {
+        auto found = mpz_scan1(this->_mpz.get_mpz_t(), offset);
+        return found == ~(mp_bitcnt_t) 0 ? -1 : (long) found;
+    }
 
     GMPBoard GMPBoard::mirrorHorizontal() const {
-        auto result = mpz_class(0);
-        for (const auto &mirrorHorizontalMask : GMPBoard::_mirrorHorizontalMasks) {
-            auto shift = mirrorHorizontalMask.first;
-            auto mask = mirrorHorizontalMask.second;
-            if (shift < 0) {
-                result = result | (mask & (this->_mpz >> abs(shift)));
-            } else {
-                result = result | (mask & (this->_mpz << shift));
-            }
-        }
-        return GMPBoard(this->_size, result);
-    }
-
-    std::unordered_map<short, const mpz_class> GMPBoard::_flipVerticalMasks = {
-            {0, mpz_class("11111110000000000000000000000000000000000000000000000000000000000000000000111110000000000000000000000000000011100000001", 2)},
-            {-2, mpz_class("110", 2)},
-            {2, mpz_class("11000", 2)},
-            {-6, mpz_class("1111110000000000000000000000000000000000000000000000000000000000011100000", 2)},
-            {6, mpz_class("1111110000000000000000000000000000000000000000000000000000000000011100000000000", 2)},
-            {-12, mpz_class("111100000000000000", 2)},
-            {-4, mpz_class("1111000000000000000000", 2)},
-            {4, mpz_class("11110000000000000000000000", 2)},
-            {12, mpz_class("111100000000000000000000000000", 2)},
-            {-20, mpz_class("11111000000000000000000000000000000", 2)},
-            {-10, mpz_class("1111100000000000000000000000000000000000", 2)},
-            {10, mpz_class("11111000000000000000000000000000000000000000000000", 2)},
-            {20, mpz_class("1111100000000000000000000000000000000000000000000000000", 2)},
-            {-30, mpz_class("1111110000000000000000000000000000000000000000000000000000000", 2)},
-            {-18, mpz_class("1111110000000000000000000000000000000000000000000000000000000000000", 2)},
-            {18, mpz_class("1111110000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {30, mpz_class("1111110000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-42, mpz_class("11111110000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-28, mpz_class("111111100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-14, mpz_class("1111111000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {14, mpz_class("111111100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {28, mpz_class("1111111000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {42, mpz_class("11111110000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-    };
+        return this->permute(this->_geometry->mirrorHorizontal);
+    }
 
     GMPBoard GMPBoard::flipVertical() const {
-        auto result = mpz_class(0);
-        for (const auto &flipVerticalMask : GMPBoard::_flipVerticalMasks) {
-            auto shift = flipVerticalMask.first;
-            auto mask = flipVerticalMask.second;
-            if (shift < 0) {
-                result = result | (mask & (this->_mpz >> abs(shift)));
-            } else {
-                result = result | (mask & (this->_mpz << shift));
-            }
-        }
-        return GMPBoard(this->_size, result);
-    }
-
-    std::unordered_map<short, const mpz_class> GMPBoard::_flipDiagonalMasks = {
-            {0, mpz_class("10000010000010000010000010000010000010000000000010000100001000010000100001000000000100010001000100010000000100100100100000101010001101", 2)},
-            {3, mpz_class("10000", 2)},
-            {-3, mpz_class("10", 2)},
-            {4, mpz_class("1010000000000", 2)},
-            {-4, mpz_class("101000000", 2)},
-            {8, mpz_class("100000100000100000100000100000100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000", 2)},
-            {-8, mpz_class("1000001000001000001000001000001000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000100000", 2)},
-            {5, mpz_class("1001001000000000000000000000", 2)},
-            {-5, mpz_class("10010010000000000000000", 2)},
-            {10, mpz_class("10010000000000000000000000000", 2)},
-            {-10, mpz_class("1001000000000000000", 2)},
-            {15, mpz_class("100000000000000000000000000000", 2)},
-            {-15, mpz_class("100000000000000", 2)},
-            {6, mpz_class("1000100010001000000000000000000000000000000000000000", 2)},
-            {-6, mpz_class("1000100010001000000000000000000000000000000000", 2)},
-            {12, mpz_class("10001000100000000000000000000000000000000000000000000", 2)},
-            {-12, mpz_class("10001000100000000000000000000000000000000", 2)},
-            {18, mpz_class("100010000000000000000000000000000000000000000000000000", 2)},
-            {-18, mpz_class("100010000000000000000000000000000000", 2)},
-            {24, mpz_class("10000010000010000010000000000000000000000000000000000000000000000000000000000000001000000000000000000000000000000000000000000000000000000", 2)},
-            {-24, mpz_class("10000010000010000010000000000000000000000000000000000000000000000000000000000000001000000000000000000000000000000", 2)},
-            {7, mpz_class("100001000010000100001000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-7, mpz_class("10000100001000010000100000000000000000000000000000000000000000000000000000000000", 2)},
-            {14, mpz_class("1000010000100001000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-14, mpz_class("10000100001000010000000000000000000000000000000000000000000000000000000000", 2)},
-            {21, mpz_class("10000100001000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-21, mpz_class("10000100001000000000000000000000000000000000000000000000000000000000", 2)},
-            {28, mpz_class("100001000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-28, mpz_class("10000100000000000000000000000000000000000000000000000000000000", 2)},
-            {35, mpz_class("1000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-35, mpz_class("10000000000000000000000000000000000000000000000000000000", 2)},
-            {16, mpz_class("1000001000001000001000001000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-16, mpz_class("100000100000100000100000100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {32, mpz_class("100000100000100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-32, mpz_class("1000001000001000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {40, mpz_class("1000001000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-40, mpz_class("100000100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {48, mpz_class("10000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-            {-48, mpz_class("10000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", 2)},
-    };
+        return this->permute(this->_geometry->flipVertical);
+    }
 
     GMPBoard GMPBoard::flipDiagonal() const {
-        auto result = mpz_class(0);
-        for (const auto &flipDiagonalMask : GMPBoard::_flipDiagonalMasks) {
-            auto shift = flipDiagonalMask.first;
-            auto mask = flipDiagonalMask.second;
-            if (shift < 0) {
-                result = result | (mask & (this->_mpz >> abs(shift)));
-            } else {
-                result = result | (mask & (this->_mpz << shift));
-            }
-        }
-        return GMPBoard(this->_size, result);
+        return this->permute(this->_geometry->flipDiagonal);
     }
 
     GMPBoard GMPBoard::rotate90() const {
@@ -202,6 +128,21 @@ namespace MosaicGame::Board {
         return this->flipVertical().flipDiagonal();
     }
 
+    GMPBoard GMPBoard::permute(const Permutation &permutation) const {
+        auto result = GMPBoard(this->_geometry, this->_size);
+        auto moved = scratch.moved.get_mpz_t();
+        for (const auto &[shift, mask]: permutation) {
+            mpz_and(moved, this->_mpz.get_mpz_t(), mask.get_mpz_t());
+            if (shift < 0) {
+                mpz_tdiv_q_2exp(moved, moved, -shift);
+            } else {
+                mpz_mul_2exp(moved, moved, shift);
+            }
+            mpz_ior(result._mpz.get_mpz_t(), result._mpz.get_mpz_t(), moved);
+        }
+        return result;
+    }
+
     GMPBoard GMPBoard::promoteZero() const {
         return this->promote(PromoteType::Zero);
     }
@@ -231,93 +172,229 @@ namespace MosaicGame::Board {
     }
 
     GMPBoard GMPBoard::promote(const GMPBoard::PromoteType promoteType) const {
-        auto result = GMPBoard(this->_size);
-        for (auto srcLayerSize = this->_size; srcLayerSize > 1; srcLayerSize--) {
+        auto result = GMPBoard(this->_geometry, this->_size);
+        auto layer = scratch.layer.get_mpz_t();
+        auto right = scratch.right.get_mpz_t();
+        auto below = scratch.below.get_mpz_t();
+        auto p1 = scratch.p1.get_mpz_t();
+        auto p2 = scratch.p2.get_mpz_t();
+        auto shifted = scratch.shifted.get_mpz_t();
+        auto promotion = scratch.promotion.get_mpz_t();
+        for (unsigned int srcLayerSize = this->_size; srcLayerSize > 1; srcLayerSize--) {
             unsigned int dstLayerSize = srcLayerSize - 1;
-            GMPBoard srcLayerMask = GMPBoard(this->_size, GMPBoard::layerMaskMpz(srcLayerSize));
-            GMPBoard srcLayer = *this & srcLayerMask;
-            GMPBoard promotionLayer = GMPBoard(this->_size);
-
+            auto layerMask = this->_geometry->layerMasks[srcLayerSize].get_mpz_t();
+            mpz_and(layer, this->_mpz.get_mpz_t(), layerMask);
             if (promoteType & (PromoteType::Zero | PromoteType::One)) {
-                srcLayer = srcLayer.flip() & srcLayerMask;
+                mpz_xor(layer, layer, layerMask);
+            }
+            if (mpz_sgn(layer) == 0) {
+                continue;
             }
+            mpz_tdiv_q_2exp(right, layer, 1);
+            mpz_tdiv_q_2exp(below, layer, srcLayerSize);
+            mpz_set_ui(promotion, 0);
 
             if (promoteType & (PromoteType::Zero | PromoteType::Four)) {
-                auto p = srcLayer & (srcLayer >> 1);
-                p = p & (p >> srcLayerSize);
-                promotionLayer = promotionLayer | p;
+                mpz_and(p1, layer, right);
+                mpz_tdiv_q_2exp(shifted, p1, srcLayerSize);
+                mpz_and(p1, p1, shifted);
+                mpz_ior(promotion, promotion, p1);
             }
 
             if (promoteType & (PromoteType::One | PromoteType::Three)) {
-                auto p1 = srcLayer & (srcLayer >> 1);
-                p1 = p1 ^ (p1 >> srcLayerSize);
-                auto p2 = srcLayer ^(srcLayer >> 1);
-                p2 = p2 ^ (p2 >> srcLayerSize);
-                promotionLayer = promotionLayer | (p1 & p2);
+                mpz_and(p1, layer, right);
+                mpz_tdiv_q_2exp(shifted, p1, srcLayerSize);
+                mpz_xor(p1, p1, shifted);
+                mpz_xor(p2, layer, right);
+                mpz_tdiv_q_2exp(shifted, p2, srcLayerSize);
+                mpz_xor(p2, p2, shifted);
+                mpz_and(p1, p1, p2);
+                mpz_ior(promotion, promotion, p1);
             }
 
             if (promoteType & PromoteType::Two) {
-                auto p1 = srcLayer ^(srcLayer >> 1);
-                p1 = p1 & (p1 >> srcLayerSize);
-                auto p2 = srcLayer ^(srcLayer >> srcLayerSize);
-                p2 = p2 & (p2 >> 1);
-                promotionLayer = promotionLayer | p1 | p2;
+                mpz_xor(p1, layer, right);
+                mpz_tdiv_q_2exp(shifted, p1, srcLayerSize);
+                mpz_and(p1, p1, shifted);
+                mpz_xor(p2, layer, below);
+                mpz_tdiv_q_2exp(shifted, p2, 1);
+                mpz_and(p2, p2, shifted);
+                mpz_ior(promotion, promotion, p1);
+                mpz_ior(promotion, promotion, p2);
             }
 
             if (promoteType & PromoteType::Majority) {
-                auto p1 = srcLayer & (srcLayer >> 1);
-                p1 = p1 | (p1 >> srcLayerSize);
-                auto p2 = srcLayer & (srcLayer >> srcLayerSize);
-                p2 = p2 | (p2 >> 1);
-                promotionLayer = promotionLayer | (p1 & p2);
+                mpz_and(p1, layer, right);
+                mpz_tdiv_q_2exp(shifted, p1, srcLayerSize);
+                mpz_ior(p1, p1, shifted);
+                mpz_and(p2, layer, below);
+                mpz_tdiv_q_2exp(shifted, p2, 1);
+                mpz_ior(p2, p2, shifted);
+                mpz_and(p1, p1, p2);
+                mpz_ior(promotion, promotion, p1);
             }
 
             if (promoteType & PromoteType::HalfOrMore) {
-                auto p1 = srcLayer | (srcLayer >> 1);
-                p1 = p1 & (p1 >> srcLayerSize);
-                auto p2 = srcLayer | (srcLayer >> srcLayerSize);
-                p2 = p2 & (p2 >> 1);
-                promotionLayer = promotionLayer | p1 | p2;
+                mpz_ior(p1, layer, right);
+                mpz_tdiv_q_2exp(shifted, p1, srcLayerSize);
+                mpz_and(p1, p1, shifted);
+                mpz_ior(p2, layer, below);
+                mpz_tdiv_q_2exp(shifted, p2, 1);
+                mpz_and(p2, p2, shifted);
+                mpz_ior(promotion, promotion, p1);
+                mpz_ior(promotion, promotion, p2);
             }
 
-            for (auto i = 0; i < dstLayerSize; i++) {
-                auto rowMask = GMPBoard(this->_size, GMPBoard::rowMaskMpz(dstLayerSize, i));
-                auto promotionRow = promotionLayer & rowMask;
-                promotionRow = promotionRow >> (dstLayerSize * dstLayerSize + i);
-                result = result | promotionRow;
+            if (mpz_sgn(promotion) == 0) {
+                continue;
+            }
+            const auto &rowMasks = this->_geometry->rowMasks[dstLayerSize];
+            for (unsigned int i = 0; i < dstLayerSize; i++) {
+                mpz_and(p1, promotion, rowMasks[i].get_mpz_t());
+                if (mpz_sgn(p1) == 0) {
+                    continue;
+                }
+                mpz_tdiv_q_2exp(p1, p1, dstLayerSize * dstLayerSize + i);
+                mpz_ior(result._mpz.get_mpz_t(), result._mpz.get_mpz_t(), p1);
             }
         }
         return result;
     }
 
     bool GMPBoard::operator==(const GMPBoard &other) const {
-        return this->_mpz == other._mpz;
+        return mpz_cmp(this->_mpz.get_mpz_t(), other._mpz.get_mpz_t()) == 0;
     }
 
     GMPBoard GMPBoard::operator&(const GMPBoard &other) const {
-        return GMPBoard(this->_size, this->_mpz & other._mpz);
+        auto result = GMPBoard(this->_geometry, this->_size);
+        mpz_and(result._mpz.get_mpz_t(), this->_mpz.get_mpz_t(), other._mpz.get_mpz_t());
+        return result;
     }
 
     GMPBoard GMPBoard::operator|(const GMPBoard &other) const {
-        return GMPBoard(this->_size, this->_mpz | other._mpz);
+        auto result = GMPBoard(this->_geometry, this->_size);
+        mpz_ior(result._mpz.get_mpz_t(), this->_mpz.get_mpz_t(), other._mpz.get_mpz_t());
+        return result;
     }
 
     GMPBoard GMPBoard::operator^(const GMPBoard &other) const {
-        return GMPBoard(this->_size, this->_mpz ^ other._mpz);
+        auto result = GMPBoard(this->_geometry, this->_size);
+        mpz_xor(result._mpz.get_mpz_t(), this->_mpz.get_mpz_t(), other._mpz.get_mpz_t());
+        return result;
     }
 
     GMPBoard GMPBoard::operator<<(unsigned int amount) const {
-        return GMPBoard(this->_size, this->_mpz << amount);
+        auto result = GMPBoard(this->_geometry, this->_size);
+        mpz_mul_2exp(result._mpz.get_mpz_t(), this->_mpz.get_mpz_t(), amount);
+        mpz_and(result._mpz.get_mpz_t(), result._mpz.get_mpz_t(), this->_geometry->boardMask.get_mpz_t());
+        return result;
     }
 
     GMPBoard GMPBoard::operator>>(unsigned int amount) const {
-        return GMPBoard(this->_size, this->_mpz >> amount);
+        auto result = GMPBoard(this->_geometry, this->_size);
+        mpz_tdiv_q_2exp(result._mpz.get_mpz_t(), this->_mpz.get_mpz_t(), amount);
+        return result;
+    }
+
+    GMPBoard &GMPBoard::operator&=(const GMPBoard &other) {
+        mpz_and(this->_mpz.get_mpz_t(), this->_mpz.get_mpz_t(), other._mpz.get_mpz_t());
+        return *this;
+    }
+
+    GMPBoard &GMPBoard::operator|=(const GMPBoard &other) {
+        mpz_ior(this->_mpz.get_mpz_t(), this->_mpz.get_mpz_t(), other._mpz.get_mpz_t());
+        return *this;
+    }
+
+    GMPBoard &GMPBoard::operator^=(const GMPBoard &other) {
+        mpz_xor(this->_mpz.get_mpz_t(), this->_mpz.get_mpz_t(), other._mpz.get_mpz_t());
+        return *this;
     }
 
     GMPBoard GMPBoard::flip() const {
-        mpz_class newMpz;
-        mpz_neg(newMpz.get_mpz_t(), this->_mpz.get_mpz_t());
-        return GMPBoard(this->_size, newMpz - 1);
+        auto result = GMPBoard(this->_geometry, this->_size);
+        mpz_xor(result._mpz.get_mpz_t(), this->_mpz.get_mpz_t(), this->_geometry->boardMask.get_mpz_t());
+        return result;
+    }
+
+    // Built on first use of each size and kept for the life of the process; boards hold a pointer to theirs.
+    const GMPBoard::Geometry &GMPBoard::geometry(unsigned char size) {
+        static std::array<std::atomic<const Geometry *>, 256> geometries = {};
+        static std::mutex mutex;
+
+        auto cached = geometries[size].load(std::memory_order_acquire);
+        if (cached != nullptr) {
+            return *cached;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        cached = geometries[size].load(std::memory_order_relaxed);
+        if (cached != nullptr) {
+            return *cached;
+        }
+
+        auto geometry = new Geometry();
+        geometry->bitSize = GMPBoard::sizeToBitSize(size);
+        for (unsigned int offset = 0; offset < geometry->bitSize; offset++) {
+            mpz_setbit(geometry->boardMask.get_mpz_t(), offset);
+        }
+        if (size % 2 == 1) {
+            mpz_setbit(geometry->neutralMask.get_mpz_t(), GMPBoard::layerShift(size) + size * size / 2);
+        }
+        geometry->layerMasks.resize(size + 1);
+        geometry->rowMasks.resize(size + 1);
+        for (unsigned int layerSize = 1; layerSize <= size; layerSize++) {
+            auto base = GMPBoard::layerShift(layerSize);
+            for (unsigned int offset = base; offset < base + layerSize * layerSize; offset++) {
+                mpz_setbit(geometry->layerMasks[layerSize].get_mpz_t(), offset);
+            }
+            if (layerSize == size) {
+                continue;
+            }
+            auto below = layerSize + 1;
+            geometry->rowMasks[layerSize].resize(layerSize);
+            for (unsigned int row = 0; row < layerSize; row++) {
+                for (unsigned int column = 0; column < layerSize; column++) {
+                    auto offset = GMPBoard::layerShift(below) + row * below + column;
+                    mpz_setbit(geometry->rowMasks[layerSize][row].get_mpz_t(), offset);
+                }
+            }
+        }
+
+        // Target cell of (row, column) in a layer whose last index is last.
+        auto permutation = [size](auto target) {
+            Permutation permutation = {};
+            for (unsigned int layerSize = 1; layerSize <= size; layerSize++) {
+                auto base = GMPBoard::layerShift(layerSize);
+                for (unsigned int row = 0; row < layerSize; row++) {
+                    for (unsigned int column = 0; column < layerSize; column++) {
+                        auto [targetRow, targetColumn] = target(row, column, layerSize - 1);
+                        auto shift = (int) (targetRow * layerSize + targetColumn) - (int) (row * layerSize + column);
+                        auto entry = permutation.begin();
+                        while (entry != permutation.end() && entry->first != shift) {
+                            entry++;
+                        }
+                        if (entry == permutation.end()) {
+                            permutation.emplace_back(shift, mpz_class(0));
+                            entry = permutation.end() - 1;
+                        }
+                        mpz_setbit(entry->second.get_mpz_t(), base + row * layerSize + column);
+                    }
+                }
+            }
+            return permutation;
+        };
+        geometry->mirrorHorizontal = permutation([](auto row, auto column, auto last) {
+            return std::pair(row, last - column);
+        });
+        geometry->flipVertical = permutation([](auto row, auto column, auto last) {
+            return std::pair(last - row, column);
+        });
+        geometry->flipDiagonal = permutation([](auto row, auto column, auto last) {
+            return std::pair(last - column, last - row);
+        });
+
+        geometries[size].store(geometry, std::memory_order_release);
+        return *geometry;
     }
 
     unsigned int GMPBoard::sizeToBitSize(unsigned char size) {
@@ -335,18 +412,4 @@ namespace MosaicGame::Board {
         }
         return layerShift;
     }
-
-    mpz_class GMPBoard::layerMaskMpz(unsigned char layerSize) {
-        auto mpzString = std::string(layerSize * layerSize, '1');
-        auto mpz = mpz_class(mpzString, 2);
-        mpz = mpz << GMPBoard::layerShift(layerSize);
-        return mpz;
-    }
-
-    mpz_class GMPBoard::rowMaskMpz(unsigned char layerSize, unsigned char rowIndex) {
-        auto result = mpz_class(std::string(layerSize, '1'), 2);
-        result = result << GMPBoard::layerShift(layerSize + 1);
-        result = result << ((layerSize + 1) * rowIndex);
-        return result;
-    }
 }
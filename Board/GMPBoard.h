@@ -3,12 +3,18 @@
 
 #include "Board.h"
 #include <gmpxx.h>
-#include <unordered_map>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace MosaicGame::Board {
-    class GMPBoard : public Board<GMPBoard> {
+    // A board of any size on an arbitrary-precision integer. The masks for each size are generated once and
+    // shared; operations write into the result with mpz_* calls and keep their intermediates in per-thread
+    // scratch integers, so the only allocation left is the limbs of a returned board. The compound
+    // operators reuse the left operand's limbs and do not allocate once it has grown to the board size.
+    class GMPBoard {
     public:
-        explicit GMPBoard(unsigned char size, const mpz_class& mpz);
+        explicit GMPBoard(unsigned char size, const mpz_class &mpz);
 
         explicit GMPBoard(unsigned int size, const std::string &mpzString);
 
@@ -20,59 +26,82 @@ namespace MosaicGame::Board {
 
         static GMPBoard neutralBoard(unsigned char size);
 
-        [[nodiscard]] unsigned int size() const override;
+        // The board holding only the given cell.
+        static GMPBoard cellBoard(unsigned char size, unsigned int offset);
 
-        [[nodiscard]] std::string toString() const override;
+        [[nodiscard]] unsigned int size() const;
 
-        [[nodiscard]] unsigned int count() const override;
+        [[nodiscard]] std::string toString() const;
 
-        [[nodiscard]] GMPBoard mirrorHorizontal() const override;
+        [[nodiscard]] unsigned int count() const;
 
-        [[nodiscard]] GMPBoard flipVertical() const override;
+        [[nodiscard]] bool test(unsigned int offset) const;
 
-        [[nodiscard]] GMPBoard flipDiagonal() const override;
+        // The offset of the lowest piece at or after the given offset, or -1 when there is none.
+        [[nodiscard]] long scan(unsigned int offset) const;
 
-        [[nodiscard]] GMPBoard rotate90() const override;
+        [[nodiscard]] GMPBoard mirrorHorizontal() const;
 
-        [[nodiscard]] GMPBoard rotate180() const override;
+        [[nodiscard]] GMPBoard flipVertical() const;
 
-        [[nodiscard]] GMPBoard rotate270() const override;
+        [[nodiscard]] GMPBoard flipDiagonal() const;
 
-        [[nodiscard]] bool operator==(const GMPBoard &other) const override;
+        [[nodiscard]] GMPBoard rotate90() const;
 
-        [[nodiscard]] GMPBoard operator&(const GMPBoard &other) const override;
+        [[nodiscard]] GMPBoard rotate180() const;
 
-        [[nodiscard]] GMPBoard operator|(const GMPBoard &other) const override;
+        [[nodiscard]] GMPBoard rotate270() const;
 
-        [[nodiscard]] GMPBoard operator^(const GMPBoard &other) const override;
+        [[nodiscard]] bool operator==(const GMPBoard &other) const;
 
-        [[nodiscard]] GMPBoard operator<<(unsigned int amount) const override;
+        [[nodiscard]] GMPBoard operator&(const GMPBoard &other) const;
 
-        [[nodiscard]] GMPBoard operator>>(unsigned int amount) const override;
+        [[nodiscard]] GMPBoard operator|(const GMPBoard &other) const;
 
-        [[nodiscard]] GMPBoard flip() const override;
+        [[nodiscard]] GMPBoard operator^(const GMPBoard &other) const;
 
-        [[nodiscard]] GMPBoard promoteZero() const override;
+        [[nodiscard]] GMPBoard operator<<(unsigned int amount) const;
 
-        [[nodiscard]] GMPBoard promoteOne() const override;
+        [[nodiscard]] GMPBoard operator>>(unsigned int amount) const;
 
-        [[nodiscard]] GMPBoard promoteTwo() const override;
+        GMPBoard &operator&=(const GMPBoard &other);
 
-        [[nodiscard]] GMPBoard promoteThree() const override;
+        GMPBoard &operator|=(const GMPBoard &other);
 
-        [[nodiscard]] GMPBoard promoteFour() const override;
+        GMPBoard &operator^=(const GMPBoard &other);
 
-        [[nodiscard]] GMPBoard promoteHalfOrMore() const override;
+        [[nodiscard]] GMPBoard flip() const;
 
-        [[nodiscard]] GMPBoard promoteMajority() const override;
+        [[nodiscard]] GMPBoard promoteZero() const;
+
+        [[nodiscard]] GMPBoard promoteOne() const;
+
+        [[nodiscard]] GMPBoard promoteTwo() const;
+
+        [[nodiscard]] GMPBoard promoteThree() const;
+
+        [[nodiscard]] GMPBoard promoteFour() const;
+
+        [[nodiscard]] GMPBoard promoteHalfOrMore() const;
+
+        [[nodiscard]] GMPBoard promoteMajority() const;
 
     private:
-        unsigned char _size;
-        unsigned int _bitSize;
-        mpz_class _mpz;
-        static std::unordered_map<short, const mpz_class> _mirrorHorizontalMasks;
-        static std::unordered_map<short, const mpz_class> _flipVerticalMasks;
-        static std::unordered_map<short, const mpz_class> _flipDiagonalMasks;
+        // Sources moved by the same distance share one mask.
+        using Permutation = std::vector<std::pair<int, mpz_class>>;
+
+        struct Geometry {
+            unsigned int bitSize;
+            mpz_class boardMask;
+            mpz_class neutralMask;
+            // By layer size.
+            std::vector<mpz_class> layerMasks;
+            // rowMasks[layerSize][row]: the cells of the layer below whose promotion lands in the row.
+            std::vector<std::vector<mpz_class>> rowMasks;
+            Permutation mirrorHorizontal;
+            Permutation flipVertical;
+            Permutation flipDiagonal;
+        };
 
         enum PromoteType : unsigned int {
             Zero = 0b0000001,
@@ -84,16 +113,25 @@ namespace MosaicGame::Board {
             HalfOrMore = 0b1000000,
         };
 
+        unsigned char _size;
+        const Geometry *_geometry;
+        mpz_class _mpz;
+
+        // An empty board whose limbs are reserved for the size.
+        explicit GMPBoard(const Geometry *geometry, unsigned char size);
+
+        [[nodiscard]] GMPBoard permute(const Permutation &permutation) const;
+
         [[nodiscard]] GMPBoard promote(PromoteType promoteType) const;
 
+        static const Geometry &geometry(unsigned char size);
+
         static unsigned int sizeToBitSize(unsigned char size);
 
         static unsigned int layerShift(unsigned char layerSize);
-
-        static mpz_class layerMaskMpz(unsigned char layerSize);
-
-        static mpz_class rowMaskMpz(unsigned char layerSize, unsigned char rowIndex);
     };
+
+    static_assert(Board<GMPBoard>);
 }
 
 #endif //MOSAICGAME_GMPBOARD_H
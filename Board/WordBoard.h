@@ -0,0 +1,494 @@
+#ifndef MOSAICGAME_WORDBOARD_H
+#define MOSAICGAME_WORDBOARD_H
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Board.h"
+#include "CellGeometry.h"
+
+namespace MosaicGame::Board {
+    // A pyramid board held in a fixed number of 64-bit words, least significant word first, with the same
+    // layout and operations as BitsetBoard. The layer, row and symmetry masks are generated from the
+    // geometry once per size, so any size that fits the words is supported: WordBoard<3> covers the sizes
+    // of BitsetBoard and WordBoard<pyramidWords(12)> goes up to 12.
+    template<unsigned int WORDS>
+    class WordBoard {
+    public:
+        static constexpr unsigned int WordCount = WORDS;
+
+        static constexpr unsigned char MaxSize = [] {
+            unsigned char size = 0;
+            while (pyramidCells(size + 1) <= 64 * WORDS) {
+                size++;
+            }
+            return size;
+        }();
+
+        using Words = std::array<std::uint64_t, WORDS>;
+
+        explicit WordBoard(unsigned char size, const Words &words) : _size(size), _words(words) {
+            if (size > WordBoard::MaxSize) {
+                throw std::runtime_error("The size is too large for the board.");
+            }
+            this->_words = WordBoard::intersect(this->_words, WordBoard::geometry(size).boardMask);
+        }
+
+        // Bits as written by toString(): the highest offset first.
+        explicit WordBoard(unsigned int size, const std::string &bitString) : WordBoard(size) {
+            auto length = bitString.size();
+            for (std::size_t i = 0; i < length && i < 64 * WORDS; i++) {
+                if (bitString[length - i - 1] == '1') {
+                    this->_words[i / 64] |= std::uint64_t(1) << (i % 64);
+                }
+            }
+            this->_words = WordBoard::intersect(this->_words, WordBoard::geometry(size).boardMask);
+        }
+
+        explicit WordBoard(unsigned int size) : WordBoard(size, Words{}) {}
+
+        static WordBoard emptyBoard(unsigned char size) {
+            return WordBoard(size);
+        }
+
+        static WordBoard groundBoard(unsigned char size) {
+            return WordBoard(size, WordBoard::layerMasks()[size]);
+        }
+
+        static WordBoard neutralBoard(unsigned char size) {
+            return WordBoard(size, WordBoard::geometry(size).neutralMask);
+        }
+
+        // The board holding only the given cell.
+        static WordBoard cellBoard(unsigned char size, unsigned int offset) {
+            Words words = {};
+            if (offset < 64 * WORDS) {
+                words[offset / 64] = std::uint64_t(1) << (offset % 64);
+            }
+            return WordBoard(size, words);
+        }
+
+        [[nodiscard]] unsigned int size() const {
+            return this->_size;
+        }
+
+        [[nodiscard]] std::string toString() const {
+            auto bitSize = pyramidCells(this->_size);
+            std::string result(bitSize, '0');
+            for (unsigned int i = 0; i < bitSize; i++) {
+                if (this->test(i)) {
+                    result[bitSize - i - 1] = '1';
+                }
+            }
+            return result;
+        }
+
+        [[nodiscard]] unsigned int count() const {
+            unsigned int count = 0;
+            for (auto word: this->_words) {
+                count += std::popcount(word);
+            }
+            return count;
+        }
+
+        [[nodiscard]] const Words &words() const {
+            return this->_words;
+        }
+
+        [[nodiscard]] bool test(unsigned int offset) const {
+            return offset < 64 * WORDS && (this->_words[offset / 64] >> (offset % 64)) & 1;
+        }
+
+        // The offset of the index-th piece in offset order. The board must have more than index pieces.
+        [[nodiscard]] unsigned int nthOffset(unsigned int index) const {
+            unsigned int word = 0;
+            for (; word + 1 < WORDS; word++) {
+                auto count = (unsigned int) std::popcount(this->_words[word]);
+                if (index < count) {
+                    break;
+                }
+                index -= count;
+            }
+            auto bits = this->_words[word];
+            for (; index > 0; index--) {
+                bits &= bits - 1;
+            }
+            return word * 64 + std::countr_zero(bits);
+        }
+
+        [[nodiscard]] WordBoard mirrorHorizontal() const {
+            return this->permute(WordBoard::geometry(this->_size).mirrorHorizontal);
+        }
+
+        [[nodiscard]] WordBoard flipVertical() const {
+            return this->permute(WordBoard::geometry(this->_size).flipVertical);
+        }
+
+        [[nodiscard]] WordBoard flipDiagonal() const {
+            return this->permute(WordBoard::geometry(this->_size).flipDiagonal);
+        }
+
+        [[nodiscard]] WordBoard rotate90() const {
+            return this->flipDiagonal().flipVertical();
+        }
+
+        [[nodiscard]] WordBoard rotate180() const {
+            return this->mirrorHorizontal().flipVertical();
+        }
+
+        [[nodiscard]] WordBoard rotate270() const {
+            return this->flipVertical().flipDiagonal();
+        }
+
+        [[nodiscard]] WordBoard promoteZero() const {
+            return this->promote(PromoteType::Zero);
+        }
+
+        [[nodiscard]] WordBoard promoteOne() const {
+            return this->promote(PromoteType::One);
+        }
+
+        [[nodiscard]] WordBoard promoteTwo() const {
+            return this->promote(PromoteType::Two);
+        }
+
+        [[nodiscard]] WordBoard promoteThree() const {
+            return this->promote(PromoteType::Three);
+        }
+
+        [[nodiscard]] WordBoard promoteFour() const {
+            return this->promote(PromoteType::Four);
+        }
+
+        [[nodiscard]] WordBoard promoteHalfOrMore() const {
+            return this->promote(PromoteType::HalfOrMore);
+        }
+
+        [[nodiscard]] WordBoard promoteMajority() const {
+            return this->promote(PromoteType::Majority);
+        }
+
+        [[nodiscard]] bool operator==(const WordBoard &other) const {
+            return this->_words == other._words;
+        }
+
+        [[nodiscard]] WordBoard operator&(const WordBoard &other) const {
+            return WordBoard(this->_size, WordBoard::intersect(this->_words, other._words), true);
+        }
+
+        [[nodiscard]] WordBoard operator|(const WordBoard &other) const {
+            auto words = this->_words;
+            for (unsigned int i = 0; i < WORDS; i++) {
+                words[i] |= other._words[i];
+            }
+            return WordBoard(this->_size, words, true);
+        }
+
+        [[nodiscard]] WordBoard operator^(const WordBoard &other) const {
+            auto words = this->_words;
+            for (unsigned int i = 0; i < WORDS; i++) {
+                words[i] ^= other._words[i];
+            }
+            return WordBoard(this->_size, words, true);
+        }
+
+        [[nodiscard]] WordBoard operator<<(unsigned int amount) const {
+            auto words = WordBoard::shiftLeft(this->_words, amount);
+            return WordBoard(this->_size, WordBoard::intersect(words, WordBoard::geometry(this->_size).boardMask), true);
+        }
+
+        [[nodiscard]] WordBoard operator>>(unsigned int amount) const {
+            return WordBoard(this->_size, WordBoard::shiftRight(this->_words, amount), true);
+        }
+
+        [[nodiscard]] WordBoard flip() const {
+            const auto &boardMask = WordBoard::geometry(this->_size).boardMask;
+            auto words = this->_words;
+            for (unsigned int i = 0; i < WORDS; i++) {
+                words[i] = ~words[i] & boardMask[i];
+            }
+            return WordBoard(this->_size, words, true);
+        }
+
+    private:
+        // Sources moved by the same distance share one mask, so a symmetry is a handful of mask-and-shift
+        // steps rather than a loop over cells.
+        using Permutation = std::vector<std::pair<int, Words>>;
+
+        struct Geometry {
+            Words boardMask;
+            Words neutralMask;
+            Permutation mirrorHorizontal;
+            Permutation flipVertical;
+            Permutation flipDiagonal;
+        };
+
+        enum PromoteType : unsigned int {
+            Zero = 0b0000001,
+            One = 0b0000010,
+            Two = 0b0000100,
+            Three = 0b0001000,
+            Four = 0b0010000,
+            Majority = 0b0100000,
+            HalfOrMore = 0b1000000,
+        };
+
+        unsigned char _size;
+        Words _words;
+
+        // For results that cannot leave the board, skipping the mask.
+        WordBoard(unsigned char size, const Words &words, bool) : _size(size), _words(words) {}
+
+        [[nodiscard]] WordBoard permute(const Permutation &permutation) const {
+            Words result = {};
+            for (const auto &[shift, mask]: permutation) {
+                auto moved = WordBoard::intersect(this->_words, mask);
+                moved = shift < 0 ? WordBoard::shiftRight(moved, -shift) : WordBoard::shiftLeft(moved, shift);
+                for (unsigned int i = 0; i < WORDS; i++) {
+                    result[i] |= moved[i];
+                }
+            }
+            return WordBoard(this->_size, result, true);
+        }
+
+        // Same construction as BitsetBoard::promote: the four cells under a cell are its own position and
+        // the next one in the layer below, and the next row of both. Rows are then packed one by one from
+        // the stride of the layer below to the stride of the layer above.
+        [[nodiscard]] WordBoard promote(PromoteType promoteType) const {
+            const auto &layerMasks = WordBoard::layerMasks();
+            const auto &rowMasks = WordBoard::rowMasks();
+            Words result = {};
+            for (unsigned int srcLayerSize = this->_size; srcLayerSize > 1; srcLayerSize--) {
+                auto dstLayerSize = srcLayerSize - 1;
+                auto srcLayer = WordBoard::intersect(this->_words, layerMasks[srcLayerSize]);
+                if (promoteType & (PromoteType::Zero | PromoteType::One)) {
+                    for (unsigned int i = 0; i < WORDS; i++) {
+                        srcLayer[i] = ~srcLayer[i] & layerMasks[srcLayerSize][i];
+                    }
+                }
+                if (WordBoard::isEmpty(srcLayer)) {
+                    continue;
+                }
+
+                auto right = WordBoard::shiftRight(srcLayer, 1);
+                auto below = WordBoard::shiftRight(srcLayer, srcLayerSize);
+                Words promotionLayer = {};
+                auto combine = [&promotionLayer](const Words &words) {
+                    for (unsigned int i = 0; i < WORDS; i++) {
+                        promotionLayer[i] |= words[i];
+                    }
+                };
+                auto apply = [](const Words &left, const Words &right, auto operation) {
+                    Words result = {};
+                    for (unsigned int i = 0; i < WORDS; i++) {
+                        result[i] = operation(left[i], right[i]);
+                    }
+                    return result;
+                };
+                auto bitAnd = [](std::uint64_t a, std::uint64_t b) { return a & b; };
+                auto bitOr = [](std::uint64_t a, std::uint64_t b) { return a | b; };
+                auto bitXor = [](std::uint64_t a, std::uint64_t b) { return a ^ b; };
+
+                if (promoteType & (PromoteType::Zero | PromoteType::Four)) {
+                    auto p = apply(srcLayer, right, bitAnd);
+                    combine(apply(p, WordBoard::shiftRight(p, srcLayerSize), bitAnd));
+                }
+                if (promoteType & (PromoteType::One | PromoteType::Three)) {
+                    auto p1 = apply(srcLayer, right, bitAnd);
+                    p1 = apply(p1, WordBoard::shiftRight(p1, srcLayerSize), bitXor);
+                    auto p2 = apply(srcLayer, right, bitXor);
+                    p2 = apply(p2, WordBoard::shiftRight(p2, srcLayerSize), bitXor);
+                    combine(apply(p1, p2, bitAnd));
+                }
+                if (promoteType & PromoteType::Two) {
+                    auto p1 = apply(srcLayer, right, bitXor);
+                    p1 = apply(p1, WordBoard::shiftRight(p1, srcLayerSize), bitAnd);
+                    auto p2 = apply(srcLayer, below, bitXor);
+                    p2 = apply(p2, WordBoard::shiftRight(p2, 1), bitAnd);
+                    combine(p1);
+                    combine(p2);
+                }
+                if (promoteType & PromoteType::Majority) {
+                    auto p1 = apply(srcLayer, right, bitAnd);
+                    p1 = apply(p1, WordBoard::shiftRight(p1, srcLayerSize), bitOr);
+                    auto p2 = apply(srcLayer, below, bitAnd);
+                    p2 = apply(p2, WordBoard::shiftRight(p2, 1), bitOr);
+                    combine(apply(p1, p2, bitAnd));
+                }
+                if (promoteType & PromoteType::HalfOrMore) {
+                    auto p1 = apply(srcLayer, right, bitOr);
+                    p1 = apply(p1, WordBoard::shiftRight(p1, srcLayerSize), bitAnd);
+                    auto p2 = apply(srcLayer, below, bitOr);
+                    p2 = apply(p2, WordBoard::shiftRight(p2, 1), bitAnd);
+                    combine(p1);
+                    combine(p2);
+                }
+                if (WordBoard::isEmpty(promotionLayer)) {
+                    continue;
+                }
+
+                for (unsigned int row = 0; row < dstLayerSize; row++) {
+                    auto promotionRow = WordBoard::intersect(promotionLayer, rowMasks[dstLayerSize][row]);
+                    if (WordBoard::isEmpty(promotionRow)) {
+                        continue;
+                    }
+                    promotionRow = WordBoard::shiftRight(promotionRow, dstLayerSize * dstLayerSize + row);
+                    for (unsigned int i = 0; i < WORDS; i++) {
+                        result[i] |= promotionRow[i];
+                    }
+                }
+            }
+            return WordBoard(this->_size, result, true);
+        }
+
+        static Words intersect(const Words &left, const Words &right) {
+            Words result = {};
+            for (unsigned int i = 0; i < WORDS; i++) {
+                result[i] = left[i] & right[i];
+            }
+            return result;
+        }
+
+        static bool isEmpty(const Words &words) {
+            for (auto word: words) {
+                if (word != 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static Words shiftLeft(const Words &words, unsigned int amount) {
+            Words result = {};
+            if (amount >= 64 * WORDS) {
+                return result;
+            }
+            auto wordShift = amount / 64;
+            auto bitShift = amount % 64;
+            for (auto i = WORDS; i-- > wordShift;) {
+                result[i] = words[i - wordShift] << bitShift;
+                if (bitShift != 0 && i > wordShift) {
+                    result[i] |= words[i - wordShift - 1] >> (64 - bitShift);
+                }
+            }
+            return result;
+        }
+
+        static Words shiftRight(const Words &words, unsigned int amount) {
+            Words result = {};
+            if (amount >= 64 * WORDS) {
+                return result;
+            }
+            auto wordShift = amount / 64;
+            auto bitShift = amount % 64;
+            for (unsigned int i = 0; i + wordShift < WORDS; i++) {
+                result[i] = words[i + wordShift] >> bitShift;
+                if (bitShift != 0 && i + wordShift + 1 < WORDS) {
+                    result[i] |= words[i + wordShift + 1] << (64 - bitShift);
+                }
+            }
+            return result;
+        }
+
+        static void set(Words &words, unsigned int offset) {
+            words[offset / 64] |= std::uint64_t(1) << (offset % 64);
+        }
+
+        // Layers sit at fixed offsets whatever the board size, so layer and row masks are shared by all sizes.
+        static const std::array<Words, MaxSize + 1> &layerMasks() {
+            static const auto layerMasks = [] {
+                std::array<Words, MaxSize + 1> layerMasks = {};
+                for (unsigned int layerSize = 1; layerSize <= MaxSize; layerSize++) {
+                    for (auto offset = pyramidCells(layerSize - 1); offset < pyramidCells(layerSize); offset++) {
+                        WordBoard::set(layerMasks[layerSize], offset);
+                    }
+                }
+                return layerMasks;
+            }();
+            return layerMasks;
+        }
+
+        // rowMasks()[layerSize][row]: the first layerSize cells of that row of the layer below, i.e. the
+        // cells whose promotion lands in the row.
+        static const std::array<std::vector<Words>, MaxSize + 1> &rowMasks() {
+            static const auto rowMasks = [] {
+                std::array<std::vector<Words>, MaxSize + 1> rowMasks = {};
+                for (unsigned int layerSize = 1; layerSize < MaxSize; layerSize++) {
+                    auto below = layerSize + 1;
+                    rowMasks[layerSize].resize(layerSize);
+                    for (unsigned int row = 0; row < layerSize; row++) {
+                        for (unsigned int column = 0; column < layerSize; column++) {
+                            WordBoard::set(rowMasks[layerSize][row], pyramidCells(layerSize) + row * below + column);
+                        }
+                    }
+                }
+                return rowMasks;
+            }();
+            return rowMasks;
+        }
+
+        static const Geometry &geometry(unsigned char size) {
+            static const auto geometries = [] {
+                std::array<Geometry, MaxSize + 1> geometries = {};
+                for (unsigned int size = 0; size <= MaxSize; size++) {
+                    auto &geometry = geometries[size];
+                    for (unsigned int offset = 0; offset < pyramidCells(size); offset++) {
+                        WordBoard::set(geometry.boardMask, offset);
+                    }
+                    if (size % 2 == 1) {
+                        WordBoard::set(geometry.neutralMask, pyramidCells(size - 1) + size * size / 2);
+                    }
+                    // Target cell of (row, column) in a layer whose last index is last.
+                    geometry.mirrorHorizontal = WordBoard::permutation(size, [](auto row, auto column, auto last) {
+                        return std::pair(row, last - column);
+                    });
+                    geometry.flipVertical = WordBoard::permutation(size, [](auto row, auto column, auto last) {
+                        return std::pair(last - row, column);
+                    });
+                    geometry.flipDiagonal = WordBoard::permutation(size, [](auto row, auto column, auto last) {
+                        return std::pair(last - column, last - row);
+                    });
+                }
+                return geometries;
+            }();
+            if (size > MaxSize) {
+                throw std::runtime_error("The size is too large for the board.");
+            }
+            return geometries[size];
+        }
+
+        template<class TARGET>
+        static Permutation permutation(unsigned int size, TARGET target) {
+            Permutation permutation = {};
+            for (unsigned int layerSize = 1; layerSize <= size; layerSize++) {
+                auto base = pyramidCells(layerSize - 1);
+                for (unsigned int row = 0; row < layerSize; row++) {
+                    for (unsigned int column = 0; column < layerSize; column++) {
+                        auto [targetRow, targetColumn] = target(row, column, layerSize - 1);
+                        auto shift = (int) (targetRow * layerSize + targetColumn) - (int) (row * layerSize + column);
+                        auto entry = permutation.begin();
+                        while (entry != permutation.end() && entry->first != shift) {
+                            entry++;
+                        }
+                        if (entry == permutation.end()) {
+                            permutation.emplace_back(shift, Words{});
+                            entry = permutation.end() - 1;
+                        }
+                        WordBoard::set(entry->second, base + row * layerSize + column);
+                    }
+                }
+            }
+            return permutation;
+        }
+    };
+
+    static_assert(Board<WordBoard<3>>);
+    static_assert(WordBoard<3>::MaxSize == 7);
+    static_assert(WordBoard<pyramidWords(12)>::MaxSize >= 12);
+}
+
+#endif //MOSAICGAME_WORDBOARD_H
@@ -0,0 +1,157 @@
+#include "BitsetOpeningBook.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace MosaicGame::Book {
+
+    BitsetOpeningBook::BitsetOpeningBook(const std::string &path) :
+            _mapping(nullptr),
+            _length(0),
+            _header(nullptr),
+            _entries(nullptr),
+            _moves(nullptr) {
+        auto descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            throw std::runtime_error("The opening book could not be opened.");
+        }
+        struct stat status{};
+        if (fstat(descriptor, &status) != 0 || status.st_size < (off_t) sizeof(BitsetOpeningBookHeader)) {
+            close(descriptor);
+            throw std::runtime_error("The opening book is truncated.");
+        }
+        this->_length = status.st_size;
+        this->_mapping = mmap(nullptr, this->_length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        close(descriptor);
+        if (this->_mapping == MAP_FAILED) {
+            throw std::runtime_error("The opening book could not be mapped.");
+        }
+
+        this->_header = (const BitsetOpeningBookHeader *) this->_mapping;
+        auto expectedLength = sizeof(BitsetOpeningBookHeader)
+                              + this->_header->entryCount * sizeof(BitsetOpeningBookEntry)
+                              + this->_header->moveCount * sizeof(BitsetOpeningBookMove);
+        if (std::memcmp(this->_header->magic, BitsetOpeningBook::Magic, sizeof(BitsetOpeningBook::Magic)) != 0
+            || this->_header->version != BitsetOpeningBook::Version
+            || expectedLength != this->_length) {
+            munmap(this->_mapping, this->_length);
+            throw std::runtime_error("The opening book is malformed.");
+        }
+        this->_entries = (const BitsetOpeningBookEntry *) (this->_header + 1);
+        this->_moves = (const BitsetOpeningBookMove *) (this->_entries + this->_header->entryCount);
+    }
+
+    BitsetOpeningBook::~BitsetOpeningBook() {
+        munmap(this->_mapping, this->_length);
+    }
+
+    std::size_t BitsetOpeningBook::positions() const {
+        return this->_header->entryCount;
+    }
+
+    bool BitsetOpeningBook::contains(const BitsetPosition &position) const {
+        return this->find(BitsetOpeningBook::key(position, BitsetOpeningBook::canonicalSymmetry(position))) != nullptr;
+    }
+
+    std::vector<BitsetOpeningBookCandidate> BitsetOpeningBook::lookup(const BitsetPosition &position) const {
+        std::vector<BitsetOpeningBookCandidate> candidates = {};
+        auto symmetry = BitsetOpeningBook::canonicalSymmetry(position);
+        auto entry = this->find(BitsetOpeningBook::key(position, symmetry));
+        if (entry == nullptr) {
+            return candidates;
+        }
+        candidates.reserve(entry->movesCount);
+        for (auto i = entry->movesIndex; i < entry->movesIndex + entry->movesCount; i++) {
+            const auto &move = this->_moves[i];
+            auto board = BitsetOpeningBook::inverseTransformBoard(
+                    BitsetMove(move.offset).toBoard(position.size()),
+                    symmetry
+            );
+            candidates.push_back({BitsetMove::fromBoard(board).front(), move.weight, move.wins});
+        }
+        return candidates;
+    }
+
+    unsigned char BitsetOpeningBook::canonicalSymmetry(const BitsetPosition &position) {
+        unsigned char canonicalSymmetry = 0;
+        auto minimumFirst = position.firstBoard().words();
+        auto minimumSecond = position.secondBoard().words();
+        for (unsigned char symmetry = 1; symmetry < 8; symmetry++) {
+            auto first = BitsetOpeningBook::transformBoard(position.firstBoard(), symmetry).words();
+            auto second = BitsetOpeningBook::transformBoard(position.secondBoard(), symmetry).words();
+            if (first < minimumFirst || (first == minimumFirst && second < minimumSecond)) {
+                canonicalSymmetry = symmetry;
+                minimumFirst = first;
+                minimumSecond = second;
+            }
+        }
+        return canonicalSymmetry;
+    }
+
+    BitsetOpeningBookKey BitsetOpeningBook::key(const BitsetPosition &position, unsigned char symmetry) {
+        BitsetOpeningBookKey key{};
+        key.first = BitsetOpeningBook::transformBoard(position.firstBoard(), symmetry).words();
+        key.second = BitsetOpeningBook::transformBoard(position.secondBoard(), symmetry).words();
+        key.size = position.size();
+        key.firstTurn = position.isFirstTurn() ? 1 : 0;
+        std::uint64_t hash = position.size() * 2 + (position.isFirstTurn() ? 0 : 1);
+        for (auto word : {key.first[0], key.first[1], key.first[2], key.second[0], key.second[1], key.second[2]}) {
+            hash ^= word + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+            hash ^= hash >> 30;
+            hash *= 0xbf58476d1ce4e5b9ULL;
+            hash ^= hash >> 27;
+            hash *= 0x94d049bb133111ebULL;
+            hash ^= hash >> 31;
+        }
+        key.hash = hash;
+        return key;
+    }
+
+    BitsetBoard BitsetOpeningBook::transformBoard(const BitsetBoard &board, unsigned char symmetry) {
+        auto result = symmetry >= 4 ? board.mirrorHorizontal() : board;
+        switch (symmetry % 4) {
+            case 1:
+                return result.rotate90();
+            case 2:
+                return result.rotate180();
+            case 3:
+                return result.rotate270();
+            default:
+                return result;
+        }
+    }
+
+    BitsetBoard BitsetOpeningBook::inverseTransformBoard(const BitsetBoard &board, unsigned char symmetry) {
+        auto result = board;
+        switch (symmetry % 4) {
+            case 1:
+                result = result.rotate270();
+                break;
+            case 2:
+                result = result.rotate180();
+                break;
+            case 3:
+                result = result.rotate90();
+                break;
+        }
+        return symmetry >= 4 ? result.mirrorHorizontal() : result;
+    }
+
+    const BitsetOpeningBookEntry *BitsetOpeningBook::find(const BitsetOpeningBookKey &key) const {
+        auto end = this->_entries + this->_header->entryCount;
+        auto entry = std::lower_bound(
+                this->_entries,
+                end,
+                key,
+                [](const BitsetOpeningBookEntry &entry, const BitsetOpeningBookKey &key) { return entry.key < key; }
+        );
+        return (entry != end && entry->key == key) ? entry : nullptr;
+    }
+}
@@ -0,0 +1,97 @@
+#ifndef MOSAICGAME_BITSETOPENINGBOOK_H
+#define MOSAICGAME_BITSETOPENINGBOOK_H
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../Game/BitsetPosition.h"
+#include "../Game/Move/BitsetMove.h"
+
+using MosaicGame::Game::BitsetPosition;
+using MosaicGame::Game::Move::BitsetMove;
+
+namespace MosaicGame::Book {
+    struct BitsetOpeningBookHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t reserved;
+        std::uint64_t entryCount;
+        std::uint64_t moveCount;
+    };
+
+    // A canonical position: entries are ordered by the hash, and the boards, size and turn tell positions with
+    // the same hash apart.
+    struct BitsetOpeningBookKey {
+        std::uint64_t hash;
+        std::array<std::uint64_t, BitsetBoard::WordCount> first;
+        std::array<std::uint64_t, BitsetBoard::WordCount> second;
+        std::uint8_t size;
+        std::uint8_t firstTurn;
+
+        auto operator<=>(const BitsetOpeningBookKey &other) const = default;
+    };
+
+    struct BitsetOpeningBookEntry {
+        BitsetOpeningBookKey key;
+        std::uint32_t movesIndex;
+        std::uint32_t movesCount;
+    };
+
+    struct BitsetOpeningBookMove {
+        std::uint32_t weight;
+        std::uint32_t wins;
+        std::uint32_t offset;
+    };
+
+    struct BitsetOpeningBookCandidate {
+        BitsetMove move;
+        unsigned int weight;
+        unsigned int wins;
+    };
+
+    // Read-only view of a book file written by BitsetOpeningBookBuilder. Entries are keyed by the
+    // canonical orientation of a position; candidates are returned in the orientation of the query.
+    class BitsetOpeningBook {
+    public:
+        explicit BitsetOpeningBook(const std::string &path);
+
+        BitsetOpeningBook(const BitsetOpeningBook &) = delete;
+
+        BitsetOpeningBook &operator=(const BitsetOpeningBook &) = delete;
+
+        ~BitsetOpeningBook();
+
+        [[nodiscard]] std::size_t positions() const;
+
+        [[nodiscard]] bool contains(const BitsetPosition &position) const;
+
+        [[nodiscard]] std::vector<BitsetOpeningBookCandidate> lookup(const BitsetPosition &position) const;
+
+        static constexpr char Magic[8] = {'M', 'G', 'B', 'O', 'O', 'K', '\0', '\0'};
+
+        static constexpr std::uint32_t Version = 2;
+
+        // Symmetry (0-7) that maps the position onto its canonical orientation.
+        [[nodiscard]] static unsigned char canonicalSymmetry(const BitsetPosition &position);
+
+        [[nodiscard]] static BitsetOpeningBookKey key(const BitsetPosition &position, unsigned char symmetry);
+
+        [[nodiscard]] static BitsetBoard transformBoard(const BitsetBoard &board, unsigned char symmetry);
+
+        [[nodiscard]] static BitsetBoard inverseTransformBoard(const BitsetBoard &board, unsigned char symmetry);
+
+    private:
+        void *_mapping;
+        std::size_t _length;
+        const BitsetOpeningBookHeader *_header;
+        const BitsetOpeningBookEntry *_entries;
+        const BitsetOpeningBookMove *_moves;
+
+        [[nodiscard]] const BitsetOpeningBookEntry *find(const BitsetOpeningBookKey &key) const;
+    };
+}
+
+#endif //MOSAICGAME_BITSETOPENINGBOOK_H
@@ -0,0 +1,89 @@
+#include "BitsetOpeningBookBuilder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace MosaicGame::Book {
+
+    BitsetOpeningBookBuilder::BitsetOpeningBookBuilder(unsigned short maxMovesMade) :
+            _maxMovesMade(maxMovesMade),
+            _entries{} {}
+
+    void BitsetOpeningBookBuilder::addGame(unsigned char size, const std::vector<BitsetMove> &moves) {
+        std::vector<std::pair<BitsetPosition, BitsetMove>> plies = {};
+        auto position = BitsetPosition(size);
+        for (const auto &move : moves) {
+            if (position.isOver() || !position.isLegalMove(move)) {
+                throw std::runtime_error("The game record contains an illegal move.");
+            }
+            if (plies.size() < this->_maxMovesMade) {
+                plies.emplace_back(position, move);
+            }
+            position = position.successor(move);
+        }
+
+        for (const auto &[ply, move] : plies) {
+            auto won = ply.isFirstTurn() ? position.firstWins() : position.secondWins();
+            this->addMove(ply, move, 1, won ? 1 : 0);
+        }
+    }
+
+    void BitsetOpeningBookBuilder::addMove(const BitsetPosition &position, const BitsetMove &move,
+                                           unsigned int weight, unsigned int wins) {
+        auto symmetry = BitsetOpeningBook::canonicalSymmetry(position);
+        auto first = BitsetOpeningBook::transformBoard(position.firstBoard(), symmetry);
+        auto second = BitsetOpeningBook::transformBoard(position.secondBoard(), symmetry);
+        auto moveBoard = BitsetOpeningBook::transformBoard(move.toBoard(position.size()), symmetry);
+
+        // Moves that are equivalent under the canonical position's own symmetries share one entry.
+        auto offset = BitsetMove::fromBoard(moveBoard).front().toOffset();
+        for (unsigned char stabilizer = 1; stabilizer < 8; stabilizer++) {
+            if (BitsetOpeningBook::transformBoard(first, stabilizer) == first
+                && BitsetOpeningBook::transformBoard(second, stabilizer) == second) {
+                auto image = BitsetOpeningBook::transformBoard(moveBoard, stabilizer);
+                offset = std::min(offset, BitsetMove::fromBoard(image).front().toOffset());
+            }
+        }
+
+        auto &statistics = this->_entries[BitsetOpeningBook::key(position, symmetry)][offset];
+        statistics.first += weight;
+        statistics.second += wins;
+    }
+
+    std::size_t BitsetOpeningBookBuilder::positions() const {
+        return this->_entries.size();
+    }
+
+    void BitsetOpeningBookBuilder::write(const std::string &path) const {
+        std::vector<BitsetOpeningBookEntry> entries = {};
+        std::vector<BitsetOpeningBookMove> moves = {};
+        entries.reserve(this->_entries.size());
+        for (const auto &[key, statistics] : this->_entries) {
+            BitsetOpeningBookEntry entry{};
+            entry.key = key;
+            entry.movesIndex = (std::uint32_t) moves.size();
+            entry.movesCount = (std::uint32_t) statistics.size();
+            entries.push_back(entry);
+            for (const auto &[offset, counts] : statistics) {
+                moves.push_back({counts.first, counts.second, offset});
+            }
+        }
+
+        BitsetOpeningBookHeader header{};
+        std::memcpy(header.magic, BitsetOpeningBook::Magic, sizeof(BitsetOpeningBook::Magic));
+        header.version = BitsetOpeningBook::Version;
+        header.entryCount = entries.size();
+        header.moveCount = moves.size();
+
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream.write((const char *) &header, sizeof(header));
+        stream.write((const char *) entries.data(), (std::streamsize) (entries.size() * sizeof(BitsetOpeningBookEntry)));
+        stream.write((const char *) moves.data(), (std::streamsize) (moves.size() * sizeof(BitsetOpeningBookMove)));
+        if (!stream) {
+            throw std::runtime_error("The opening book could not be written.");
+        }
+    }
+}
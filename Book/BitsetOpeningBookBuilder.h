@@ -0,0 +1,34 @@
+#ifndef MOSAICGAME_BITSETOPENINGBOOKBUILDER_H
+#define MOSAICGAME_BITSETOPENINGBOOKBUILDER_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BitsetOpeningBook.h"
+
+namespace MosaicGame::Book {
+    class BitsetOpeningBookBuilder {
+    public:
+        explicit BitsetOpeningBookBuilder(unsigned short maxMovesMade);
+
+        // Replays a recorded game and credits each of its first maxMovesMade moves, counting a win
+        // for the mover when the game ended with them winning.
+        void addGame(unsigned char size, const std::vector<BitsetMove> &moves);
+
+        // Credits a single move, e.g. from search output where weight is the visit count.
+        void addMove(const BitsetPosition &position, const BitsetMove &move, unsigned int weight, unsigned int wins);
+
+        [[nodiscard]] std::size_t positions() const;
+
+        void write(const std::string &path) const;
+
+    private:
+        unsigned short _maxMovesMade;
+        // Ordered as the entries are written.
+        std::map<BitsetOpeningBookKey, std::map<unsigned int, std::pair<std::uint32_t, std::uint32_t>>> _entries;
+    };
+}
+
+#endif //MOSAICGAME_BITSETOPENINGBOOKBUILDER_H
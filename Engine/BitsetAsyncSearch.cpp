@@ -0,0 +1,58 @@
+#include "BitsetAsyncSearch.h"
+
+#include <utility>
+
+namespace MosaicGame::Engine {
+
+    BitsetAsyncSearch::BitsetAsyncSearch(std::unique_ptr<BitsetEngine> engine, const BitsetPosition &position,
+                                         std::uint64_t seed, BitsetSearchControl::Clock::duration timeLimit,
+                                         unsigned long long nodeLimit) :
+            _engine(std::move(engine)),
+            _done(false) {
+        this->_control.setNodeLimit(nodeLimit);
+        if (timeLimit.count() > 0) {
+            this->_control.setDeadline(BitsetSearchControl::Clock::now() + timeLimit);
+        }
+        this->_thread = std::thread([this, position, seed]() {
+            try {
+                this->_result = this->_engine->search(position, seed, this->_control);
+            } catch (...) {
+                this->_error = std::current_exception();
+            }
+            this->_done.store(true, std::memory_order_release);
+        });
+    }
+
+    BitsetAsyncSearch::~BitsetAsyncSearch() {
+        this->cancel();
+        if (this->_thread.joinable()) {
+            this->_thread.join();
+        }
+    }
+
+    bool BitsetAsyncSearch::isDone() const {
+        return this->_done.load(std::memory_order_acquire);
+    }
+
+    BitsetSearchProgress BitsetAsyncSearch::progress() const {
+        return this->_control.progress();
+    }
+
+    void BitsetAsyncSearch::cancel() {
+        this->_control.stop();
+    }
+
+    void BitsetAsyncSearch::extendDeadline(BitsetSearchControl::Clock::duration extension) {
+        this->_control.extendDeadline(extension);
+    }
+
+    BitsetSearchResult BitsetAsyncSearch::wait() {
+        if (this->_thread.joinable()) {
+            this->_thread.join();
+        }
+        if (this->_error != nullptr) {
+            std::rethrow_exception(this->_error);
+        }
+        return *this->_result;
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef MOSAICGAME_BITSETASYNCSEARCH_H
+#define MOSAICGAME_BITSETASYNCSEARCH_H
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <thread>
+#include "BitsetEngine.h"
+#include "BitsetSearchControl.h"
+
+namespace MosaicGame::Engine {
+    // Runs one engine search on a background thread. The position is copied at construction, so the
+    // caller's game may change while the search runs. Destroying the search cancels and joins it.
+    class BitsetAsyncSearch {
+    public:
+        explicit BitsetAsyncSearch(std::unique_ptr<BitsetEngine> engine, const BitsetPosition &position,
+                                   std::uint64_t seed, BitsetSearchControl::Clock::duration timeLimit,
+                                   unsigned long long nodeLimit = std::numeric_limits<unsigned long long>::max());
+
+        BitsetAsyncSearch(const BitsetAsyncSearch &) = delete;
+
+        BitsetAsyncSearch &operator=(const BitsetAsyncSearch &) = delete;
+
+        ~BitsetAsyncSearch();
+
+        [[nodiscard]] bool isDone() const;
+
+        [[nodiscard]] BitsetSearchProgress progress() const;
+
+        void cancel();
+
+        void extendDeadline(BitsetSearchControl::Clock::duration extension);
+
+        // Blocks until the search finishes and returns its result, rethrowing any error it raised.
+        BitsetSearchResult wait();
+
+    private:
+        std::unique_ptr<BitsetEngine> _engine;
+        BitsetSearchControl _control;
+        std::optional<BitsetSearchResult> _result;
+        std::exception_ptr _error;
+        std::atomic<bool> _done;
+        std::thread _thread;
+    };
+}
+
+#endif //MOSAICGAME_BITSETASYNCSEARCH_H
@@ -0,0 +1,39 @@
+#ifndef MOSAICGAME_BITSETENGINE_H
+#define MOSAICGAME_BITSETENGINE_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../Game/BitsetPosition.h"
+#include "../Game/Move/BitsetMove.h"
+#include "BitsetSearchControl.h"
+#include "SearchResult.h"
+
+using MosaicGame::Game::BitsetPosition;
+using MosaicGame::Game::Move::BitsetMove;
+
+namespace MosaicGame::Engine {
+    using BitsetSearchResult = SearchResult<BitsetMove>;
+
+    // Engines chosen at run time by name, as the factory, asynchronous search, self-play and the C API do. The
+    // implementations wrap the engine templates, so the call is virtual once per search, not per node.
+    class BitsetEngine {
+    public:
+        virtual ~BitsetEngine() = default;
+
+        [[nodiscard]] virtual std::string name() const = 0;
+
+        // Searches a position that is not over. The same position and seed always yield the same result
+        // unless the control stops the search early; at least one iteration always completes.
+        [[nodiscard]] virtual BitsetSearchResult search(const BitsetPosition &position, std::uint64_t seed,
+                                                        BitsetSearchControl &control) = 0;
+
+        [[nodiscard]] BitsetSearchResult search(const BitsetPosition &position, std::uint64_t seed) {
+            BitsetSearchControl control;
+            return this->search(position, seed, control);
+        }
+    };
+}
+
+#endif //MOSAICGAME_BITSETENGINE_H
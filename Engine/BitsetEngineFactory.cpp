@@ -0,0 +1,22 @@
+#include "BitsetEngineFactory.h"
+
+#include <stdexcept>
+#include "BitsetMonteCarloEngine.h"
+#include "BitsetRandomEngine.h"
+
+namespace MosaicGame::Engine {
+
+    std::unique_ptr<BitsetEngine> BitsetEngineFactory::create(const std::string &specification) {
+        auto separator = specification.find(':');
+        auto name = specification.substr(0, separator);
+        auto parameter = separator == std::string::npos ? std::string() : specification.substr(separator + 1);
+
+        if (name == "random" && parameter.empty()) {
+            return std::make_unique<BitsetRandomEngine>();
+        }
+        if (name == "montecarlo") {
+            return std::make_unique<BitsetMonteCarloEngine>(parameter.empty() ? 256 : std::stoul(parameter));
+        }
+        throw std::runtime_error("Unknown engine: " + specification);
+    }
+}
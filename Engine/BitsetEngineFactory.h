@@ -0,0 +1,16 @@
+#ifndef MOSAICGAME_BITSETENGINEFACTORY_H
+#define MOSAICGAME_BITSETENGINEFACTORY_H
+
+#include <memory>
+#include <string>
+#include "BitsetEngine.h"
+
+namespace MosaicGame::Engine {
+    class BitsetEngineFactory {
+    public:
+        // Specifications are "random" or "montecarlo:<playouts>", where 0 playouts is unbounded.
+        [[nodiscard]] static std::unique_ptr<BitsetEngine> create(const std::string &specification);
+    };
+}
+
+#endif //MOSAICGAME_BITSETENGINEFACTORY_H
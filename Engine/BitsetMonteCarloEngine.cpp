@@ -0,0 +1,22 @@
+#include "BitsetMonteCarloEngine.h"
+
+#include <utility>
+
+namespace MosaicGame::Engine {
+
+    BitsetMonteCarloEngine::BitsetMonteCarloEngine(unsigned int playouts) :
+            _engine(playouts) {}
+
+    std::string BitsetMonteCarloEngine::name() const {
+        return this->_engine.name();
+    }
+
+    BitsetSearchResult BitsetMonteCarloEngine::search(const BitsetPosition &position, std::uint64_t seed,
+                                                      BitsetSearchControl &control) {
+        return this->_engine.search(position, seed, control);
+    }
+
+    bool BitsetMonteCarloEngine::playout(BitsetPosition position, std::mt19937_64 &random, unsigned long long &nodes) {
+        return MonteCarloEngine<BitsetPosition>::playout(std::move(position), random, nodes);
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef MOSAICGAME_BITSETMONTECARLOENGINE_H
+#define MOSAICGAME_BITSETMONTECARLOENGINE_H
+
+#include <random>
+#include "BitsetEngine.h"
+#include "MonteCarloEngine.h"
+
+namespace MosaicGame::Engine {
+    // MonteCarloEngine over bitset positions.
+    class BitsetMonteCarloEngine : public BitsetEngine {
+    public:
+        explicit BitsetMonteCarloEngine(unsigned int playouts);
+
+        [[nodiscard]] std::string name() const override;
+
+        using BitsetEngine::search;
+
+        [[nodiscard]] BitsetSearchResult search(const BitsetPosition &position, std::uint64_t seed,
+                                                BitsetSearchControl &control) override;
+
+        // Plays uniformly random moves to the end and reports whether the first player won.
+        [[nodiscard]] static bool playout(BitsetPosition position, std::mt19937_64 &random, unsigned long long &nodes);
+
+    private:
+        MonteCarloEngine<BitsetPosition> _engine;
+    };
+}
+
+#endif //MOSAICGAME_BITSETMONTECARLOENGINE_H
@@ -0,0 +1,13 @@
+#include "BitsetRandomEngine.h"
+
+namespace MosaicGame::Engine {
+
+    std::string BitsetRandomEngine::name() const {
+        return this->_engine.name();
+    }
+
+    BitsetSearchResult BitsetRandomEngine::search(const BitsetPosition &position, std::uint64_t seed,
+                                                  BitsetSearchControl &control) {
+        return this->_engine.search(position, seed, control);
+    }
+}
@@ -0,0 +1,22 @@
+#ifndef MOSAICGAME_BITSETRANDOMENGINE_H
+#define MOSAICGAME_BITSETRANDOMENGINE_H
+
+#include "BitsetEngine.h"
+#include "RandomEngine.h"
+
+namespace MosaicGame::Engine {
+    class BitsetRandomEngine : public BitsetEngine {
+    public:
+        [[nodiscard]] std::string name() const override;
+
+        using BitsetEngine::search;
+
+        [[nodiscard]] BitsetSearchResult search(const BitsetPosition &position, std::uint64_t seed,
+                                                BitsetSearchControl &control) override;
+
+    private:
+        RandomEngine<BitsetPosition> _engine;
+    };
+}
+
+#endif //MOSAICGAME_BITSETRANDOMENGINE_H
@@ -0,0 +1,66 @@
+#include "BitsetSearchControl.h"
+
+#include <limits>
+
+namespace MosaicGame::Engine {
+
+    BitsetSearchControl::BitsetSearchControl() :
+            _stopped(false),
+            _deadline(std::numeric_limits<Clock::rep>::max()),
+            _nodeLimit(std::numeric_limits<unsigned long long>::max()),
+            _depth(0),
+            _iterations(0),
+            _nodes(0),
+            _bestMove(BitsetSearchControl::NoMove) {}
+
+    void BitsetSearchControl::stop() {
+        this->_stopped.store(true, std::memory_order_relaxed);
+    }
+
+    void BitsetSearchControl::setDeadline(Clock::time_point deadline) {
+        this->_deadline.store(deadline.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+    void BitsetSearchControl::extendDeadline(Clock::duration extension) {
+        auto deadline = this->_deadline.load(std::memory_order_relaxed);
+        while (deadline != std::numeric_limits<Clock::rep>::max() &&
+               !this->_deadline.compare_exchange_weak(deadline, deadline + extension.count(),
+                                                      std::memory_order_relaxed)) {}
+    }
+
+    void BitsetSearchControl::setNodeLimit(unsigned long long nodes) {
+        this->_nodeLimit.store(nodes, std::memory_order_relaxed);
+    }
+
+    bool BitsetSearchControl::shouldStop(unsigned long long nodes) const {
+        if (this->_stopped.load(std::memory_order_relaxed)) {
+            return true;
+        }
+        if (nodes >= this->_nodeLimit.load(std::memory_order_relaxed)) {
+            return true;
+        }
+        auto deadline = this->_deadline.load(std::memory_order_relaxed);
+        return deadline != std::numeric_limits<Clock::rep>::max() &&
+               Clock::now().time_since_epoch().count() >= deadline;
+    }
+
+    void BitsetSearchControl::report(unsigned int depth, unsigned int iterations, unsigned long long nodes,
+                                     unsigned int bestMove) {
+        this->_depth.store(depth, std::memory_order_relaxed);
+        this->_iterations.store(iterations, std::memory_order_relaxed);
+        this->_nodes.store(nodes, std::memory_order_relaxed);
+        this->_bestMove.store((int) bestMove, std::memory_order_relaxed);
+    }
+
+    BitsetSearchProgress BitsetSearchControl::progress() const {
+        auto bestMove = this->_bestMove.load(std::memory_order_relaxed);
+        return {
+                this->_depth.load(std::memory_order_relaxed),
+                this->_iterations.load(std::memory_order_relaxed),
+                this->_nodes.load(std::memory_order_relaxed),
+                bestMove == BitsetSearchControl::NoMove
+                ? std::nullopt
+                : std::optional<BitsetMove>(BitsetMove(bestMove)),
+        };
+    }
+}
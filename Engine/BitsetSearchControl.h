@@ -0,0 +1,57 @@
+#ifndef MOSAICGAME_BITSETSEARCHCONTROL_H
+#define MOSAICGAME_BITSETSEARCHCONTROL_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include "../Game/Move/BitsetMove.h"
+
+using MosaicGame::Game::Move::BitsetMove;
+
+namespace MosaicGame::Engine {
+    struct BitsetSearchProgress {
+        // Plies of the deepest line examined from the searched position, e.g. the longest playout.
+        unsigned int depth;
+        unsigned int iterations;
+        unsigned long long nodes;
+        std::optional<BitsetMove> bestMove;
+    };
+
+    // Limits and progress shared between a running search and whoever started it. Engines poll
+    // shouldStop() between iterations and publish progress; every member is safe to use concurrently.
+    class BitsetSearchControl {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        BitsetSearchControl();
+
+        void stop();
+
+        void setDeadline(Clock::time_point deadline);
+
+        void extendDeadline(Clock::duration extension);
+
+        void setNodeLimit(unsigned long long nodes);
+
+        [[nodiscard]] bool shouldStop(unsigned long long nodes) const;
+
+        // bestMove is the offset of the move the search prefers so far.
+        void report(unsigned int depth, unsigned int iterations, unsigned long long nodes, unsigned int bestMove);
+
+        [[nodiscard]] BitsetSearchProgress progress() const;
+
+    private:
+        static constexpr int NoMove = -1;
+
+        std::atomic<bool> _stopped;
+        std::atomic<Clock::rep> _deadline;
+        std::atomic<unsigned long long> _nodeLimit;
+        std::atomic<unsigned int> _depth;
+        std::atomic<unsigned int> _iterations;
+        std::atomic<unsigned long long> _nodes;
+        std::atomic<int> _bestMove;
+    };
+}
+
+#endif //MOSAICGAME_BITSETSEARCHCONTROL_H
@@ -0,0 +1,120 @@
+#ifndef MOSAICGAME_MONTECARLOENGINE_H
+#define MOSAICGAME_MONTECARLOENGINE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "BitsetSearchControl.h"
+#include "SearchResult.h"
+#include "../Game/Position.h"
+#include "../Instrumentation/Tracer.h"
+
+namespace MosaicGame::Engine {
+    // Flat Monte Carlo search: random playouts are spread over the legal moves by UCB1 and the most
+    // visited move is played. Zero playouts means no fixed budget; the search runs until its control
+    // stops it.
+    template<Game::Position POSITION>
+    class MonteCarloEngine {
+    public:
+        using MoveType = typename POSITION::MoveType;
+
+        explicit MonteCarloEngine(unsigned int playouts) :
+                _playouts(playouts == 0 ? std::numeric_limits<unsigned int>::max() : playouts) {}
+
+        [[nodiscard]] std::string name() const {
+            if (this->_playouts == std::numeric_limits<unsigned int>::max()) {
+                return "montecarlo:0";
+            }
+            return "montecarlo:" + std::to_string(this->_playouts);
+        }
+
+        [[nodiscard]] SearchResult<MoveType> search(const POSITION &position, std::uint64_t seed,
+                                                    BitsetSearchControl &control) const {
+            using MosaicGame::Instrumentation::Tracer;
+
+            MOSAICGAME_TRACE_SPAN("search", "engine");
+            auto legalMoves = MoveType::fromBoard(position.legalBoard());
+            if (position.isOver() || legalMoves.empty()) {
+                throw std::runtime_error("The position has no move to search.");
+            }
+
+            auto random = std::mt19937_64(seed);
+            std::vector<unsigned int> visits(legalMoves.size(), 0);
+            std::vector<unsigned int> wins(legalMoves.size(), 0);
+            unsigned long long nodes = 0;
+            unsigned int depth = 0;
+            std::size_t leader = 0;
+            auto batchStart = Tracer::enabled() ? Tracer::now() : 0;
+            for (unsigned int playout = 0; playout < this->_playouts; playout++) {
+                if (playout > 0 && control.shouldStop(nodes)) {
+                    break;
+                }
+                if (playout % PlayoutsPerTraceSpan == 0 && playout > 0 && batchStart != 0) {
+                    auto now = Tracer::now();
+                    Tracer::record("playouts", "engine", batchStart, now);
+                    batchStart = now;
+                }
+                std::size_t selected = 0;
+                auto bestScore = -1.0;
+                for (std::size_t i = 0; i < legalMoves.size(); i++) {
+                    if (visits[i] == 0) {
+                        selected = i;
+                        break;
+                    }
+                    auto score = (double) wins[i] / visits[i] + std::sqrt(2.0 * std::log(playout) / visits[i]);
+                    if (score > bestScore) {
+                        bestScore = score;
+                        selected = i;
+                    }
+                }
+                auto playoutStart = nodes;
+                auto firstWins = MonteCarloEngine::playout(position.successor(legalMoves[selected]), random, nodes);
+                // The selected move plus the random moves played after it.
+                depth = std::max(depth, (unsigned int) (nodes - playoutStart + 1));
+                visits[selected]++;
+                wins[selected] += firstWins == position.isFirstTurn() ? 1 : 0;
+                if (visits[selected] > visits[leader]) {
+                    leader = selected;
+                }
+                control.report(depth, playout + 1, nodes, legalMoves[leader].toOffset());
+            }
+            if (batchStart != 0) {
+                Tracer::record("playouts", "engine", batchStart, Tracer::now());
+            }
+
+            std::size_t best = 0;
+            SearchResult<MoveType> result = {legalMoves.front(), {}, nodes};
+            result.visits.reserve(legalMoves.size());
+            for (std::size_t i = 0; i < legalMoves.size(); i++) {
+                if (visits[i] > visits[best]) {
+                    best = i;
+                }
+                result.visits.emplace_back(legalMoves[i], visits[i]);
+            }
+            result.bestMove = legalMoves[best];
+            return result;
+        }
+
+        // Plays uniformly random moves to the end and reports whether the first player won.
+        [[nodiscard]] static bool playout(POSITION position, std::mt19937_64 &random, unsigned long long &nodes) {
+            while (!position.isOver()) {
+                auto legalBoard = position.legalBoard();
+                position = position.successor(MoveType::nthFromBoard(legalBoard, random() % legalBoard.count()));
+                nodes++;
+            }
+            return position.firstWins();
+        }
+
+    private:
+        static constexpr unsigned int PlayoutsPerTraceSpan = 32;
+
+        unsigned int _playouts;
+    };
+}
+
+#endif //MOSAICGAME_MONTECARLOENGINE_H
@@ -0,0 +1,39 @@
+#ifndef MOSAICGAME_RANDOMENGINE_H
+#define MOSAICGAME_RANDOMENGINE_H
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include "BitsetSearchControl.h"
+#include "SearchResult.h"
+#include "../Game/Position.h"
+#include "../Instrumentation/Tracer.h"
+
+namespace MosaicGame::Engine {
+    // Plays a uniformly random legal move.
+    template<Game::Position POSITION>
+    class RandomEngine {
+    public:
+        using MoveType = typename POSITION::MoveType;
+
+        [[nodiscard]] std::string name() const {
+            return "random";
+        }
+
+        [[nodiscard]] SearchResult<MoveType> search(const POSITION &position, std::uint64_t seed,
+                                                    BitsetSearchControl &control) const {
+            MOSAICGAME_TRACE_SPAN("search", "engine");
+            auto legalMoves = MoveType::fromBoard(position.legalBoard());
+            if (position.isOver() || legalMoves.empty()) {
+                throw std::runtime_error("The position has no move to search.");
+            }
+            auto random = std::mt19937_64(seed);
+            auto move = legalMoves[random() % legalMoves.size()];
+            control.report(1, 1, 1, move.toOffset());
+            return {move, {{move, 1}}, 1};
+        }
+    };
+}
+
+#endif //MOSAICGAME_RANDOMENGINE_H
@@ -0,0 +1,16 @@
+#ifndef MOSAICGAME_SEARCHRESULT_H
+#define MOSAICGAME_SEARCHRESULT_H
+
+#include <utility>
+#include <vector>
+
+namespace MosaicGame::Engine {
+    template<class MOVE>
+    struct SearchResult {
+        MOVE bestMove;
+        std::vector<std::pair<MOVE, unsigned int>> visits;
+        unsigned long long nodes;
+    };
+}
+
+#endif //MOSAICGAME_SEARCHRESULT_H
@@ -0,0 +1,168 @@
+#include "AnyOneToOneGame.h"
+
+namespace MosaicGame::Game {
+
+    void AnyOneToOneGame::reset(unsigned char size) {
+        this->_game = this->_game->create(size);
+    }
+
+    unsigned char AnyOneToOneGame::size() const {
+        return this->_game->size();
+    }
+
+    unsigned short AnyOneToOneGame::piecesPerPlayer() const {
+        return this->_game->piecesPerPlayer();
+    }
+
+    unsigned short AnyOneToOneGame::movesMade() const {
+        return this->_game->movesMade();
+    }
+
+    std::vector<unsigned int> AnyOneToOneGame::moves() const {
+        return this->_game->moves();
+    }
+
+    std::vector<unsigned int> AnyOneToOneGame::legalMoves() const {
+        return this->_game->legalMoves();
+    }
+
+    bool AnyOneToOneGame::isOver() const {
+        return this->_game->isOver();
+    }
+
+    unsigned short AnyOneToOneGame::firstScore() const {
+        return this->_game->firstScore();
+    }
+
+    unsigned short AnyOneToOneGame::secondScore() const {
+        return this->_game->secondScore();
+    }
+
+    unsigned short AnyOneToOneGame::playerScore() const {
+        return this->_game->playerScore();
+    }
+
+    unsigned short AnyOneToOneGame::opponentScore() const {
+        return this->_game->opponentScore();
+    }
+
+    bool AnyOneToOneGame::firstWins() const {
+        return this->_game->firstWins();
+    }
+
+    bool AnyOneToOneGame::secondWins() const {
+        return this->_game->secondWins();
+    }
+
+    bool AnyOneToOneGame::playerWins() const {
+        return this->_game->playerWins();
+    }
+
+    bool AnyOneToOneGame::opponentWins() const {
+        return this->_game->opponentWins();
+    }
+
+    bool AnyOneToOneGame::isFirstTurn() const {
+        return this->_game->isFirstTurn();
+    }
+
+    bool AnyOneToOneGame::isSecondTurn() const {
+        return this->_game->isSecondTurn();
+    }
+
+    bool AnyOneToOneGame::isLegalMove(unsigned int offset) const {
+        return this->_game->isLegalMove(offset);
+    }
+
+    std::string AnyOneToOneGame::firstBoard() const {
+        return this->_game->firstBoard();
+    }
+
+    std::string AnyOneToOneGame::secondBoard() const {
+        return this->_game->secondBoard();
+    }
+
+    std::string AnyOneToOneGame::neutralBoard() const {
+        return this->_game->neutralBoard();
+    }
+
+    std::string AnyOneToOneGame::legalBoard() const {
+        return this->_game->legalBoard();
+    }
+
+    std::string AnyOneToOneGame::playerBoard() const {
+        return this->_game->playerBoard();
+    }
+
+    std::string AnyOneToOneGame::opponentBoard() const {
+        return this->_game->opponentBoard();
+    }
+
+    bool AnyOneToOneGame::isUndoable() const {
+        return this->_game->isUndoable();
+    }
+
+    bool AnyOneToOneGame::isRedoable() const {
+        return this->_game->isRedoable();
+    }
+
+    std::size_t AnyOneToOneGame::state() const {
+        return this->_game->state();
+    }
+
+    GameStatus AnyOneToOneGame::tryMakeMove(unsigned int offset) {
+        return this->_game->tryMakeMove(offset);
+    }
+
+    GameStatus AnyOneToOneGame::tryUndo() {
+        return this->_game->tryUndo();
+    }
+
+    GameStatus AnyOneToOneGame::tryRedo() {
+        return this->_game->tryRedo();
+    }
+
+    void AnyOneToOneGame::makeMove(unsigned int offset) {
+        this->_game->makeMove(offset);
+    }
+
+    void AnyOneToOneGame::undo() {
+        this->_game->undo();
+    }
+
+    void AnyOneToOneGame::redo() {
+        this->_game->redo();
+    }
+
+    void AnyOneToOneGame::flipVertical() {
+        this->_game->flipVertical();
+    }
+
+    void AnyOneToOneGame::mirrorHorizontal() {
+        this->_game->mirrorHorizontal();
+    }
+
+    void AnyOneToOneGame::flipDiagonal() {
+        this->_game->flipDiagonal();
+    }
+
+    void AnyOneToOneGame::rotate90() {
+        this->_game->rotate90();
+    }
+
+    void AnyOneToOneGame::rotate180() {
+        this->_game->rotate180();
+    }
+
+    void AnyOneToOneGame::rotate270() {
+        this->_game->rotate270();
+    }
+
+    void AnyOneToOneGame::transform() {
+        this->_game->transform();
+    }
+
+    void AnyOneToOneGame::resetTransformation() {
+        this->_game->resetTransformation();
+    }
+}
@@ -0,0 +1,411 @@
+#ifndef MOSAICGAME_ANYONETOONEGAME_H
+#define MOSAICGAME_ANYONETOONEGAME_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "OneToOneGame.h"
+
+namespace MosaicGame::Game {
+    // Holds any OneToOneGame behind one run-time interface, for callers that pick the backend at run time
+    // or sit behind a binary interface. Moves are cell offsets and boards are toString() strings. There is
+    // one indirect call per game operation; the rules underneath stay statically dispatched.
+    class AnyOneToOneGame {
+    public:
+        template<OneToOneGame GAME>
+        explicit AnyOneToOneGame(GAME game) : _game(std::make_unique<Holder<GAME>>(std::move(game))) {}
+
+        AnyOneToOneGame(const AnyOneToOneGame &other) : _game(other._game->clone()) {}
+
+        AnyOneToOneGame(AnyOneToOneGame &&other) noexcept = default;
+
+        AnyOneToOneGame &operator=(const AnyOneToOneGame &other) {
+            if (this != &other) {
+                this->_game = other._game->clone();
+            }
+            return *this;
+        }
+
+        AnyOneToOneGame &operator=(AnyOneToOneGame &&other) noexcept = default;
+
+        // The wrapped game when it is a GAME, for callers with a faster path for a known backend.
+        template<OneToOneGame GAME>
+        [[nodiscard]] GAME *get() {
+            auto holder = dynamic_cast<Holder<GAME> *>(this->_game.get());
+            return holder == nullptr ? nullptr : &holder->game;
+        }
+
+        template<OneToOneGame GAME>
+        [[nodiscard]] const GAME *get() const {
+            auto holder = dynamic_cast<const Holder<GAME> *>(this->_game.get());
+            return holder == nullptr ? nullptr : &holder->game;
+        }
+
+        // Starts a new game of the given size on the same backend.
+        void reset(unsigned char size);
+
+        [[nodiscard]] unsigned char size() const;
+
+        [[nodiscard]] unsigned short piecesPerPlayer() const;
+
+        [[nodiscard]] unsigned short movesMade() const;
+
+        [[nodiscard]] std::vector<unsigned int> moves() const;
+
+        [[nodiscard]] std::vector<unsigned int> legalMoves() const;
+
+        [[nodiscard]] bool isOver() const;
+
+        [[nodiscard]] unsigned short firstScore() const;
+
+        [[nodiscard]] unsigned short secondScore() const;
+
+        [[nodiscard]] unsigned short playerScore() const;
+
+        [[nodiscard]] unsigned short opponentScore() const;
+
+        [[nodiscard]] bool firstWins() const;
+
+        [[nodiscard]] bool secondWins() const;
+
+        [[nodiscard]] bool playerWins() const;
+
+        [[nodiscard]] bool opponentWins() const;
+
+        [[nodiscard]] bool isFirstTurn() const;
+
+        [[nodiscard]] bool isSecondTurn() const;
+
+        [[nodiscard]] bool isLegalMove(unsigned int offset) const;
+
+        [[nodiscard]] std::string firstBoard() const;
+
+        [[nodiscard]] std::string secondBoard() const;
+
+        [[nodiscard]] std::string neutralBoard() const;
+
+        [[nodiscard]] std::string legalBoard() const;
+
+        [[nodiscard]] std::string playerBoard() const;
+
+        [[nodiscard]] std::string opponentBoard() const;
+
+        [[nodiscard]] bool isUndoable() const;
+
+        [[nodiscard]] bool isRedoable() const;
+
+        [[nodiscard]] std::size_t state() const;
+
+        GameStatus tryMakeMove(unsigned int offset);
+
+        GameStatus tryUndo();
+
+        GameStatus tryRedo();
+
+        void makeMove(unsigned int offset);
+
+        void undo();
+
+        void redo();
+
+        void flipVertical();
+
+        void mirrorHorizontal();
+
+        void flipDiagonal();
+
+        void rotate90();
+
+        void rotate180();
+
+        void rotate270();
+
+        void transform();
+
+        void resetTransformation();
+
+    private:
+        class Erased {
+        public:
+            virtual ~Erased() = default;
+
+            [[nodiscard]] virtual std::unique_ptr<Erased> clone() const = 0;
+
+            [[nodiscard]] virtual std::unique_ptr<Erased> create(unsigned char size) const = 0;
+
+            [[nodiscard]] virtual unsigned char size() const = 0;
+
+            [[nodiscard]] virtual unsigned short piecesPerPlayer() const = 0;
+
+            [[nodiscard]] virtual unsigned short movesMade() const = 0;
+
+            [[nodiscard]] virtual std::vector<unsigned int> moves() const = 0;
+
+            [[nodiscard]] virtual std::vector<unsigned int> legalMoves() const = 0;
+
+            [[nodiscard]] virtual bool isOver() const = 0;
+
+            [[nodiscard]] virtual unsigned short firstScore() const = 0;
+
+            [[nodiscard]] virtual unsigned short secondScore() const = 0;
+
+            [[nodiscard]] virtual unsigned short playerScore() const = 0;
+
+            [[nodiscard]] virtual unsigned short opponentScore() const = 0;
+
+            [[nodiscard]] virtual bool firstWins() const = 0;
+
+            [[nodiscard]] virtual bool secondWins() const = 0;
+
+            [[nodiscard]] virtual bool playerWins() const = 0;
+
+            [[nodiscard]] virtual bool opponentWins() const = 0;
+
+            [[nodiscard]] virtual bool isFirstTurn() const = 0;
+
+            [[nodiscard]] virtual bool isSecondTurn() const = 0;
+
+            [[nodiscard]] virtual bool isLegalMove(unsigned int offset) const = 0;
+
+            [[nodiscard]] virtual std::string firstBoard() const = 0;
+
+            [[nodiscard]] virtual std::string secondBoard() const = 0;
+
+            [[nodiscard]] virtual std::string neutralBoard() const = 0;
+
+            [[nodiscard]] virtual std::string legalBoard() const = 0;
+
+            [[nodiscard]] virtual std::string playerBoard() const = 0;
+
+            [[nodiscard]] virtual std::string opponentBoard() const = 0;
+
+            [[nodiscard]] virtual bool isUndoable() const = 0;
+
+            [[nodiscard]] virtual bool isRedoable() const = 0;
+
+            [[nodiscard]] virtual std::size_t state() const = 0;
+
+            virtual GameStatus tryMakeMove(unsigned int offset) = 0;
+
+            virtual GameStatus tryUndo() = 0;
+
+            virtual GameStatus tryRedo() = 0;
+
+            virtual void makeMove(unsigned int offset) = 0;
+
+            virtual void undo() = 0;
+
+            virtual void redo() = 0;
+
+            virtual void flipVertical() = 0;
+
+            virtual void mirrorHorizontal() = 0;
+
+            virtual void flipDiagonal() = 0;
+
+            virtual void rotate90() = 0;
+
+            virtual void rotate180() = 0;
+
+            virtual void rotate270() = 0;
+
+            virtual void transform() = 0;
+
+            virtual void resetTransformation() = 0;
+        };
+
+        template<OneToOneGame GAME>
+        class Holder final : public Erased {
+        public:
+            using Move = typename GAME::MoveType;
+
+            GAME game;
+
+            explicit Holder(GAME game) : game(std::move(game)) {}
+
+            [[nodiscard]] std::unique_ptr<Erased> clone() const override {
+                return std::make_unique<Holder>(this->game);
+            }
+
+            [[nodiscard]] std::unique_ptr<Erased> create(unsigned char size) const override {
+                return std::make_unique<Holder>(GAME(size));
+            }
+
+            [[nodiscard]] unsigned char size() const override {
+                return this->game.size();
+            }
+
+            [[nodiscard]] unsigned short piecesPerPlayer() const override {
+                return this->game.piecesPerPlayer();
+            }
+
+            [[nodiscard]] unsigned short movesMade() const override {
+                return this->game.movesMade();
+            }
+
+            [[nodiscard]] std::vector<unsigned int> moves() const override {
+                return Holder::offsets(this->game.moves());
+            }
+
+            [[nodiscard]] std::vector<unsigned int> legalMoves() const override {
+                return Holder::offsets(this->game.legalMoves());
+            }
+
+            [[nodiscard]] bool isOver() const override {
+                return this->game.isOver();
+            }
+
+            [[nodiscard]] unsigned short firstScore() const override {
+                return this->game.firstScore();
+            }
+
+            [[nodiscard]] unsigned short secondScore() const override {
+                return this->game.secondScore();
+            }
+
+            [[nodiscard]] unsigned short playerScore() const override {
+                return this->game.playerScore();
+            }
+
+            [[nodiscard]] unsigned short opponentScore() const override {
+                return this->game.opponentScore();
+            }
+
+            [[nodiscard]] bool firstWins() const override {
+                return this->game.firstWins();
+            }
+
+            [[nodiscard]] bool secondWins() const override {
+                return this->game.secondWins();
+            }
+
+            [[nodiscard]] bool playerWins() const override {
+                return this->game.playerWins();
+            }
+
+            [[nodiscard]] bool opponentWins() const override {
+                return this->game.opponentWins();
+            }
+
+            [[nodiscard]] bool isFirstTurn() const override {
+                return this->game.isFirstTurn();
+            }
+
+            [[nodiscard]] bool isSecondTurn() const override {
+                return this->game.isSecondTurn();
+            }
+
+            [[nodiscard]] bool isLegalMove(unsigned int offset) const override {
+                return this->game.isLegalMove(Move(offset));
+            }
+
+            [[nodiscard]] std::string firstBoard() const override {
+                return this->game.firstBoard().toString();
+            }
+
+            [[nodiscard]] std::string secondBoard() const override {
+                return this->game.secondBoard().toString();
+            }
+
+            [[nodiscard]] std::string neutralBoard() const override {
+                return this->game.neutralBoard().toString();
+            }
+
+            [[nodiscard]] std::string legalBoard() const override {
+                return this->game.legalBoard().toString();
+            }
+
+            [[nodiscard]] std::string playerBoard() const override {
+                return this->game.playerBoard().toString();
+            }
+
+            [[nodiscard]] std::string opponentBoard() const override {
+                return this->game.opponentBoard().toString();
+            }
+
+            [[nodiscard]] bool isUndoable() const override {
+                return this->game.isUndoable();
+            }
+
+            [[nodiscard]] bool isRedoable() const override {
+                return this->game.isRedoable();
+            }
+
+            [[nodiscard]] std::size_t state() const override {
+                return this->game.state();
+            }
+
+            GameStatus tryMakeMove(unsigned int offset) override {
+                return this->game.tryMakeMove(Move(offset));
+            }
+
+            GameStatus tryUndo() override {
+                return this->game.tryUndo();
+            }
+
+            GameStatus tryRedo() override {
+                return this->game.tryRedo();
+            }
+
+            void makeMove(unsigned int offset) override {
+                this->game.makeMove(Move(offset));
+            }
+
+            void undo() override {
+                this->game.undo();
+            }
+
+            void redo() override {
+                this->game.redo();
+            }
+
+            void flipVertical() override {
+                this->game.flipVertical();
+            }
+
+            void mirrorHorizontal() override {
+                this->game.mirrorHorizontal();
+            }
+
+            void flipDiagonal() override {
+                this->game.flipDiagonal();
+            }
+
+            void rotate90() override {
+                this->game.rotate90();
+            }
+
+            void rotate180() override {
+                this->game.rotate180();
+            }
+
+            void rotate270() override {
+                this->game.rotate270();
+            }
+
+            void transform() override {
+                this->game.transform();
+            }
+
+            void resetTransformation() override {
+                this->game.resetTransformation();
+            }
+
+        private:
+            static std::vector<unsigned int> offsets(const std::vector<Move> &moves) {
+                std::vector<unsigned int> offsets = {};
+                offsets.reserve(moves.size());
+                for (const auto &move: moves) {
+                    offsets.emplace_back(move.toOffset());
+                }
+                return offsets;
+            }
+        };
+
+        std::unique_ptr<Erased> _game;
+    };
+}
+
+#endif //MOSAICGAME_ANYONETOONEGAME_H
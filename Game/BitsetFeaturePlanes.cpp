@@ -0,0 +1,99 @@
+#include "BitsetFeaturePlanes.h"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <vector>
+
+using MosaicGame::Board::BitsetCellGeometry;
+
+namespace MosaicGame::Game {
+
+    std::size_t BitsetFeaturePlanes::length(unsigned char size) {
+        return BitsetFeaturePlanes::Planes * size * size * size;
+    }
+
+    void BitsetFeaturePlanes::write(const BitsetPosition &position, std::uint8_t *buffer) {
+        BitsetFeaturePlanes::writePlanes(position, buffer);
+    }
+
+    void BitsetFeaturePlanes::write(const BitsetPosition &position, float *buffer) {
+        BitsetFeaturePlanes::writePlanes(position, buffer);
+    }
+
+    void BitsetFeaturePlanes::write(const std::vector<BitsetPosition> &positions, std::uint8_t *buffer) {
+        for (const auto &position : positions) {
+            BitsetFeaturePlanes::writePlanes(position, buffer);
+            buffer += BitsetFeaturePlanes::length(position.size());
+        }
+    }
+
+    void BitsetFeaturePlanes::write(const std::vector<BitsetPosition> &positions, float *buffer) {
+        for (const auto &position : positions) {
+            BitsetFeaturePlanes::writePlanes(position, buffer);
+            buffer += BitsetFeaturePlanes::length(position.size());
+        }
+    }
+
+    template<class T>
+    void BitsetFeaturePlanes::writePlanes(const BitsetPosition &position, T *buffer) {
+        const auto size = position.size();
+        const auto planeLength = (std::size_t) size * size * size;
+        const auto &cellIndices = BitsetFeaturePlanes::cellIndices(size);
+        std::fill(buffer, buffer + BitsetFeaturePlanes::length(size), T(0));
+
+        auto playerBoard = position.isFirstTurn() ? position.firstBoard() : position.secondBoard();
+        auto opponentBoard = position.isFirstTurn() ? position.secondBoard() : position.firstBoard();
+        const std::bitset<140> bitsets[] = {
+                playerBoard.bitset(),
+                opponentBoard.bitset(),
+                position.neutralBoard().bitset(),
+                position.legalBoard().bitset(),
+                playerBoard.promoteMajority().bitset(),
+                opponentBoard.promoteMajority().bitset(),
+        };
+        for (unsigned int plane = Plane::Player; plane <= Plane::OpponentMajority; plane++) {
+            auto planeBuffer = buffer + plane * planeLength;
+            for (unsigned int offset = 0; offset < cellIndices.size(); offset++) {
+                if (bitsets[plane].test(offset)) {
+                    planeBuffer[cellIndices[offset]] = T(1);
+                }
+            }
+        }
+
+        auto occupied = position.occupiedBoard().bitset();
+        auto supportBuffer = buffer + Plane::SupportCount * planeLength;
+        for (unsigned int offset = 0; offset < cellIndices.size(); offset++) {
+            if (BitsetCellGeometry::isGround(size, offset)) {
+                supportBuffer[cellIndices[offset]] = T(4);
+                continue;
+            }
+            const auto &supports = BitsetCellGeometry::cell(offset).supports;
+            supportBuffer[cellIndices[offset]] = T(
+                    occupied.test(supports[0])
+                    + occupied.test(supports[1])
+                    + occupied.test(supports[2])
+                    + occupied.test(supports[3])
+            );
+        }
+
+        if (position.isFirstTurn()) {
+            auto turnBuffer = buffer + Plane::FirstTurn * planeLength;
+            std::fill(turnBuffer, turnBuffer + planeLength, T(1));
+        }
+    }
+
+    const std::vector<unsigned int> &BitsetFeaturePlanes::cellIndices(unsigned char size) {
+        static const auto cellIndices = [] {
+            std::array<std::vector<unsigned int>, 8> cellIndices = {};
+            for (unsigned int size = 1; size < cellIndices.size(); size++) {
+                for (unsigned int offset = 0; offset < Board::pyramidCells(size); offset++) {
+                    auto [layer, row, column] = BitsetCellGeometry::cell(offset).coordinate;
+                    cellIndices[size].emplace_back((layer * size + row) * size + column);
+                }
+            }
+            return cellIndices;
+        }();
+        return cellIndices.at(size);
+    }
+}
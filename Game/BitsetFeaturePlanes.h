@@ -0,0 +1,49 @@
+#ifndef MOSAICGAME_BITSETFEATUREPLANES_H
+#define MOSAICGAME_BITSETFEATUREPLANES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "BitsetPosition.h"
+
+namespace MosaicGame::Game {
+    // Writes positions as a dense [plane][layer][row][column] tensor of shape
+    // Planes x size x size x size, batches being consecutive tensors. Layer 0 is the apex; a layer of
+    // width w occupies the top-left w x w corner of its size x size slice and the rest is zero, so the
+    // cell (r, c) of a layer rests on (r..r+1, c..c+1) of the layer below.
+    class BitsetFeaturePlanes {
+    public:
+        enum Plane : unsigned int {
+            Player = 0,
+            Opponent = 1,
+            Neutral = 2,
+            Legal = 3,
+            PlayerMajority = 4,
+            OpponentMajority = 5,
+            // Occupied supporting cells (0-4); ground cells are reported as 4.
+            SupportCount = 6,
+            // Every cell is 1 when the first player is to move.
+            FirstTurn = 7,
+        };
+
+        static constexpr unsigned int Planes = 8;
+
+        [[nodiscard]] static std::size_t length(unsigned char size);
+
+        static void write(const BitsetPosition &position, std::uint8_t *buffer);
+
+        static void write(const BitsetPosition &position, float *buffer);
+
+        static void write(const std::vector<BitsetPosition> &positions, std::uint8_t *buffer);
+
+        static void write(const std::vector<BitsetPosition> &positions, float *buffer);
+
+    private:
+        template<class T>
+        static void writePlanes(const BitsetPosition &position, T *buffer);
+
+        [[nodiscard]] static const std::vector<unsigned int> &cellIndices(unsigned char size);
+    };
+}
+
+#endif //MOSAICGAME_BITSETFEATUREPLANES_H
@@ -0,0 +1,52 @@
+#include "BitsetGamePool.h"
+
+#include <memory>
+#include <vector>
+
+namespace MosaicGame::Game {
+
+    static std::vector<std::unique_ptr<BitsetOneToOneGame>> &cache() {
+        // The node cache must outlive the games cached below.
+        thread_local auto prepared = (MoveHistory<BitsetMove>::prepareThread(BitsetMove(0)), true);
+        (void) prepared;
+        thread_local std::vector<std::unique_ptr<BitsetOneToOneGame>> games = {};
+        return games;
+    }
+
+    BitsetOneToOneGame *BitsetGamePool::acquire(unsigned char size) {
+        auto &games = cache();
+        if (games.empty()) {
+            return new BitsetOneToOneGame(size);
+        }
+        // Reset before leaving the cache, so a game is not lost when the size is rejected.
+        games.back()->reset(size);
+        auto game = games.back().release();
+        games.pop_back();
+        return game;
+    }
+
+    BitsetOneToOneGame *BitsetGamePool::acquire(const BitsetOneToOneGame &other) {
+        auto &games = cache();
+        if (games.empty()) {
+            return new BitsetOneToOneGame(other);
+        }
+        auto game = games.back().release();
+        games.pop_back();
+        *game = other;
+        return game;
+    }
+
+    void BitsetGamePool::release(BitsetOneToOneGame *game) {
+        auto &games = cache();
+        if (games.size() >= BitsetGamePool::Capacity) {
+            delete game;
+            return;
+        }
+        // Cached games hold no history, so no nodes are freed when the cache is destroyed.
+        game->reset(game->size());
+        if (games.capacity() == 0) {
+            games.reserve(BitsetGamePool::Capacity);
+        }
+        games.emplace_back(game);
+    }
+}
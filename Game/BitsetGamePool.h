@@ -0,0 +1,22 @@
+#ifndef MOSAICGAME_BITSETGAMEPOOL_H
+#define MOSAICGAME_BITSETGAMEPOOL_H
+
+#include <cstddef>
+#include "BitsetOneToOneGame.h"
+
+namespace MosaicGame::Game {
+    // Recycles game objects through a per-thread cache instead of new/delete. Released games are
+    // reset on reuse; games beyond the cache capacity are deleted.
+    class BitsetGamePool {
+    public:
+        static constexpr std::size_t Capacity = 256;
+
+        [[nodiscard]] static BitsetOneToOneGame *acquire(unsigned char size);
+
+        [[nodiscard]] static BitsetOneToOneGame *acquire(const BitsetOneToOneGame &other);
+
+        static void release(BitsetOneToOneGame *game);
+    };
+}
+
+#endif //MOSAICGAME_BITSETGAMEPOOL_H
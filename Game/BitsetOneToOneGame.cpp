@@ -1,22 +1,88 @@
 #include "BitsetOneToOneGame.h"
 
+#include <array>
+#include <bit>
+#include <bitset>
 #include <utility>
+#include "BitsetPosition.h"
 #include "Move/BitsetMove.h"
+#include "../Instrumentation/Instrumentation.h"
 
 namespace MosaicGame::Game {
 
+    namespace {
+        constexpr unsigned int CellCount = 140;
+
+        // Orientation mirrored * 4 + rotations: mirror first, then rotate clockwise.
+        constexpr unsigned int OrientationCount = 8;
+
+        using OrientationTable = std::array<std::array<unsigned char, CellCount>, OrientationCount>;
+
+        struct OrientationTables {
+            // views[size][orientation][cell]: where a cell of the stored boards is shown.
+            std::array<OrientationTable, BitsetBoard::MaxSize + 1> views;
+            // The inverse of views.
+            std::array<OrientationTable, BitsetBoard::MaxSize + 1> cells;
+        };
+
+        const OrientationTables &orientationTables() {
+            static const auto tables = [] {
+                OrientationTables tables = {};
+                for (unsigned int size = 0; size <= BitsetBoard::MaxSize; size++) {
+                    for (unsigned int orientation = 0; orientation < OrientationCount; orientation++) {
+                        auto &views = tables.views[size][orientation];
+                        auto &cells = tables.cells[size][orientation];
+                        for (unsigned int cell = 0; cell < CellCount; cell++) {
+                            views[cell] = cell;
+                            cells[cell] = cell;
+                        }
+                        unsigned int base = 0;
+                        for (unsigned int layerSize = 1; layerSize <= size; layerSize++) {
+                            auto last = layerSize - 1;
+                            for (unsigned int row = 0; row < layerSize; row++) {
+                                for (unsigned int column = 0; column < layerSize; column++) {
+                                    auto viewRow = row;
+                                    auto viewColumn = orientation >= 4 ? last - column : column;
+                                    for (unsigned int i = 0; i < orientation % 4; i++) {
+                                        auto rotatedRow = viewColumn;
+                                        viewColumn = last - viewRow;
+                                        viewRow = rotatedRow;
+                                    }
+                                    auto cell = base + row * layerSize + column;
+                                    auto view = base + viewRow * layerSize + viewColumn;
+                                    views[cell] = view;
+                                    cells[view] = cell;
+                                }
+                            }
+                            base += layerSize * layerSize;
+                        }
+                    }
+                }
+                return tables;
+            }();
+            return tables;
+        }
+
+        unsigned char supportedSize(unsigned char size) {
+            if (size < 1 || size > BitsetBoard::MaxSize) {
+                throw std::runtime_error("The size is not supported.");
+            }
+            return size;
+        }
+    }
+
     BitsetOneToOneGame::BitsetOneToOneGame(unsigned char size, std::vector<BitsetMove> moves, bool mirrored,
                                            short rotations) :
-            _size(size),
+            _size(supportedSize(size)),
             _firstBoard(BitsetBoard::emptyBoard(size)),
             _secondBoard(BitsetBoard::emptyBoard(size)),
             _neutralBoard(BitsetBoard::neutralBoard(size)),
             _groundBoard(BitsetBoard::groundBoard(size)),
-            _moves(std::move(moves)),
+            _moves(moves),
             _undoCount(0),
             _piecesPerPlayer(BitsetBoard::emptyBoard(size).flip().count() / 2),
             _mirrored(mirrored),
-            _rotations(rotations) {
+            _rotations((rotations % 4 + 4) % 4) {
         this->replay();
     }
 
@@ -32,11 +98,11 @@ namespace MosaicGame::Game {
     }
 
     unsigned short BitsetOneToOneGame::movesMade() const {
-        return this->moves().size();
+        return this->_moves.size() - this->_undoCount;
     }
 
     std::vector<BitsetMove> BitsetOneToOneGame::moves() const {
-        return std::vector<BitsetMove>(this->_moves.begin(), this->_moves.end() - this->_undoCount);
+        return this->_moves.pop(this->_undoCount).toVector();
     }
 
     std::vector<BitsetMove> BitsetOneToOneGame::legalMoves() const {
@@ -56,11 +122,11 @@ namespace MosaicGame::Game {
     }
 
     unsigned short BitsetOneToOneGame::playerScore() const {
-        return this->playerBoard().count();
+        return this->playerBoardAtMovesMade(this->movesMade()).count();
     }
 
     unsigned short BitsetOneToOneGame::opponentScore() const {
-        return this->opponentBoard().count();
+        return this->playerBoardAtMovesMade(this->movesMade() + 1).count();
     }
 
     bool BitsetOneToOneGame::firstWins() const {
@@ -72,11 +138,11 @@ namespace MosaicGame::Game {
     }
 
     bool BitsetOneToOneGame::playerWins() const {
-        return this->_piecesPerPlayer <= this->playerBoard().count();
+        return this->_piecesPerPlayer <= this->playerScore();
     }
 
     bool BitsetOneToOneGame::opponentWins() const {
-        return this->_piecesPerPlayer <= this->opponentBoard().count();
+        return this->_piecesPerPlayer <= this->opponentScore();
     }
 
     bool BitsetOneToOneGame::isFirstTurn() const {
@@ -88,22 +154,32 @@ namespace MosaicGame::Game {
     }
 
     bool BitsetOneToOneGame::isLegalMove(const BitsetMove &move) const {
-        return (this->legalBoard() & move.toBoard(this->_size)).count() > 0;
+        auto cellMove = BitsetMove(this->cellOffset(move.toOffset()));
+        return (this->cellLegalBoard() & cellMove.toBoard(this->_size)).count() > 0;
     }
 
     BitsetBoard BitsetOneToOneGame::firstBoard() const {
-        return this->_firstBoard;
+        return this->viewBoard(this->_firstBoard);
     }
 
     BitsetBoard BitsetOneToOneGame::secondBoard() const {
-        return this->_secondBoard;
+        return this->viewBoard(this->_secondBoard);
     }
 
     BitsetBoard BitsetOneToOneGame::neutralBoard() const {
-        return this->_neutralBoard;
+        return this->viewBoard(this->_neutralBoard);
     }
 
     BitsetBoard BitsetOneToOneGame::legalBoard() const {
+        return this->viewBoard(this->cellLegalBoard());
+    }
+
+    BitsetPosition BitsetOneToOneGame::position() const {
+        return BitsetPosition(this->firstBoard(), this->secondBoard(), this->neutralBoard(), this->isFirstTurn());
+    }
+
+    BitsetBoard BitsetOneToOneGame::cellLegalBoard() const {
+        MOSAICGAME_COUNT(LegalBoards, 1);
         return this->vacantBoard() & this->scaffoldedBoard();
     }
 
@@ -126,11 +202,11 @@ namespace MosaicGame::Game {
     }
 
     BitsetBoard BitsetOneToOneGame::playerBoard() const {
-        return this->playerBoardAtMovesMade(this->movesMade());
+        return this->viewBoard(this->playerBoardAtMovesMade(this->movesMade()));
     }
 
     BitsetBoard BitsetOneToOneGame::opponentBoard() const {
-        return this->playerBoardAtMovesMade(this->movesMade() + 1);
+        return this->viewBoard(this->playerBoardAtMovesMade(this->movesMade() + 1));
     }
 
     bool BitsetOneToOneGame::isUndoable() const {
@@ -141,107 +217,113 @@ namespace MosaicGame::Game {
         return this->_undoCount > 0;
     }
 
-    void BitsetOneToOneGame::makeMove(const BitsetMove &move) {
+    GameStatus BitsetOneToOneGame::tryMakeMove(const BitsetMove &move) {
 
         if (this->isOver()) {
-            throw std::runtime_error("The game is already over.");
+            return GameStatus::GameOver;
         }
 
-        if (!this->isLegalMove(move)) {
-            throw std::runtime_error("Making an illegal move is attempted.");
+        if (CellCount <= move.toOffset() || !this->isLegalMove(move)) {
+            return GameStatus::IllegalMove;
         }
 
-        this->handleMove(move, this->movesMade());
+        auto cellMove = BitsetMove(this->cellOffset(move.toOffset()));
+        this->handleMove(cellMove, this->movesMade());
 
-        this->_moves = this->moves();
-        this->_moves.emplace_back(this->normalizeMove(move));
+        this->_moves = this->_moves.pop(this->_undoCount).push(cellMove);
         this->_undoCount = 0;
+        return GameStatus::Ok;
     }
 
-    void BitsetOneToOneGame::handleMove(const BitsetMove &move, unsigned int movesMade) {
-
-        if (movesMade % 2 == 0) {
-            this->_firstBoard = this->_firstBoard | move.toBoard(this->_size);
-        } else {
-            this->_secondBoard = this->_secondBoard | move.toBoard(this->_size);
+    void BitsetOneToOneGame::makeMove(const BitsetMove &move) {
+        switch (this->tryMakeMove(move)) {
+            case GameStatus::GameOver:
+                throw std::runtime_error("The game is already over.");
+            case GameStatus::IllegalMove:
+                throw std::runtime_error("Making an illegal move is attempted.");
+            default:
+                break;
         }
+    }
 
-        auto legalBoard = this->legalBoard();
-        auto firstMajorityBoard = this->firstBoard().promoteMajority();
-        auto secondMajorityBoard = this->secondBoard().promoteMajority();
-
-        do {
-            auto chained = false;
-            BitsetBoard firstChainBoard = legalBoard & firstMajorityBoard;
-            if (firstChainBoard.count()) {
-                auto firstVacancy = this->_piecesPerPlayer - this->_firstBoard.count();
-                if (firstChainBoard.count() <= firstVacancy) {
-                    this->_firstBoard = this->_firstBoard | firstChainBoard;
-                } else {
-                    auto chainMoves = BitsetMove::fromBoard(firstChainBoard);
-                    for (auto i = 0; i < firstVacancy; i++) {
-                        BitsetMove chainMove = chainMoves.front();
-                        chainMoves.erase(chainMoves.begin());
-                        this->_firstBoard = this->_firstBoard | chainMove.toBoard(this->_size);
-                    }
-                }
-                chained = true;
-                legalBoard = this->legalBoard();
-                firstMajorityBoard = this->firstBoard().promoteMajority();
-            }
-
-            BitsetBoard secondChainBoard = legalBoard & secondMajorityBoard;
-            if (secondChainBoard.count()) {
-                auto secondVacancy = this->_piecesPerPlayer - this->_secondBoard.count();
-                if (secondChainBoard.count() <= secondVacancy) {
-                    this->_secondBoard = this->_secondBoard | secondChainBoard;
-                } else {
-                    auto chainMoves = BitsetMove::fromBoard(secondChainBoard);
-                    for (auto i = 0; i < secondVacancy; i++) {
-                        BitsetMove chainMove = chainMoves.front();
-                        chainMoves.erase(chainMoves.begin());
-                        this->_secondBoard = this->_secondBoard | chainMove.toBoard(this->_size);
-                    }
-                }
-                chained = true;
-                legalBoard = this->legalBoard();
-                secondMajorityBoard = this->secondBoard().promoteMajority();
-            }
+    void BitsetOneToOneGame::reset(unsigned char size) {
+        this->_size = supportedSize(size);
+        this->_groundBoard = BitsetBoard::groundBoard(size);
+        this->_moves = MoveHistory<BitsetMove>();
+        this->_undoCount = 0;
+        this->_piecesPerPlayer = BitsetBoard::emptyBoard(size).flip().count() / 2;
+        this->_mirrored = false;
+        this->_rotations = 0;
+        this->resetBoards();
+    }
 
-            if (!chained) {
-                break;
-            }
-        } while (!this->isOver());
+    void BitsetOneToOneGame::handleMove(const BitsetMove &move, unsigned int movesMade) {
+        auto position = BitsetPosition(
+                this->_firstBoard,
+                this->_secondBoard,
+                this->_neutralBoard,
+                movesMade % 2 == 0
+        ).successor(move);
+        if (position.isOver() && this->orientation() != 0) {
+            // A chain that runs out of pieces fills the lowest offsets as shown, so only a move that ends the
+            // game depends on the orientation. It is resolved again in the shown orientation.
+            position = BitsetPosition(
+                    this->viewBoard(this->_firstBoard),
+                    this->viewBoard(this->_secondBoard),
+                    this->viewBoard(this->_neutralBoard),
+                    movesMade % 2 == 0
+            ).successor(BitsetMove(this->viewOffset(move.toOffset())));
+            this->_firstBoard = this->cellBoard(position.firstBoard());
+            this->_secondBoard = this->cellBoard(position.secondBoard());
+            return;
+        }
+        this->_firstBoard = position.firstBoard();
+        this->_secondBoard = position.secondBoard();
     }
 
     std::size_t BitsetOneToOneGame::state() const {
-        return std::hash<std::string>{}(this->_firstBoard.toString() + this->_secondBoard.toString());
+        return std::hash<std::string>{}(this->firstBoard().toString() + this->secondBoard().toString());
     }
 
-    void BitsetOneToOneGame::undo() {
+    GameStatus BitsetOneToOneGame::tryUndo() {
         if (!this->isUndoable()) {
-            throw std::runtime_error("The game is not undoable.");
+            return GameStatus::NotUndoable;
         }
 
         this->_undoCount++;
         this->replay();
+        return GameStatus::Ok;
     }
 
-    void BitsetOneToOneGame::redo() {
+    GameStatus BitsetOneToOneGame::tryRedo() {
         if (!this->isRedoable()) {
-            throw std::runtime_error("The game is not redoable.");
+            return GameStatus::NotRedoable;
         }
 
         this->_undoCount--;
         this->replay();
+        return GameStatus::Ok;
+    }
+
+    void BitsetOneToOneGame::undo() {
+        if (this->tryUndo() != GameStatus::Ok) {
+            throw std::runtime_error("The game is not undoable.");
+        }
+    }
+
+    void BitsetOneToOneGame::redo() {
+        if (this->tryRedo() != GameStatus::Ok) {
+            throw std::runtime_error("The game is not redoable.");
+        }
     }
 
     void BitsetOneToOneGame::replay() {
+        MOSAICGAME_COUNT(Replays, 1);
         this->resetBoards();
         auto movesMade = 0;
-        for (const auto &move: this->moves()) {
-            this->handleMove(this->transformMove(move), movesMade);
-        }
+        this->_moves.pop(this->_undoCount).forEach([this, &movesMade](const BitsetMove &move) {
+            this->handleMove(move, movesMade++);
+        });
     }
 
     void BitsetOneToOneGame::resetBoards() {
@@ -253,47 +335,33 @@ namespace MosaicGame::Game {
     void BitsetOneToOneGame::flipVertical() {
         this->mirrored();
         this->rotated(2);
-        this->_firstBoard = this->_firstBoard.flipVertical();
-        this->_secondBoard = this->_secondBoard.flipVertical();
     }
 
     void BitsetOneToOneGame::mirrorHorizontal() {
         this->mirrored();
-        this->_firstBoard = this->_firstBoard.mirrorHorizontal();
-        this->_secondBoard = this->_secondBoard.mirrorHorizontal();
     }
 
     void BitsetOneToOneGame::flipDiagonal() {
         this->mirrored();
         this->rotated(1);
-        this->_firstBoard = this->_firstBoard.flipDiagonal();
-        this->_secondBoard = this->_secondBoard.flipDiagonal();
     }
 
     void BitsetOneToOneGame::rotate90() {
         this->rotated(1);
-        this->_firstBoard = this->_firstBoard.rotate90();
-        this->_secondBoard = this->_secondBoard.rotate90();
     }
 
     void BitsetOneToOneGame::rotate180() {
         this->rotated(2);
-        this->_firstBoard = this->_firstBoard.rotate180();
-        this->_secondBoard = this->_secondBoard.rotate180();
     }
 
     void BitsetOneToOneGame::rotate270() {
         this->rotated(3);
-        this->_firstBoard = this->_firstBoard.rotate270();
-        this->_secondBoard = this->_secondBoard.rotate270();
     }
 
     void BitsetOneToOneGame::transform() {
         auto minimumState = this->state();
         auto mirrored = this->_mirrored;
         auto rotations = this->_rotations;
-        auto minimumFirstBoard = this->_firstBoard;
-        auto minimumSecondBoard = this->_secondBoard;
         for (auto i = 0; i < 7; i++) {
             if (i == 3) {
                 mirrorHorizontal();
@@ -305,80 +373,64 @@ namespace MosaicGame::Game {
                 minimumState = newState;
                 mirrored = this->_mirrored;
                 rotations = this->_rotations;
-                minimumFirstBoard = this->_firstBoard;
-                minimumSecondBoard = this->_secondBoard;
             }
         }
         this->_mirrored = mirrored;
         this->_rotations = rotations;
-        this->_firstBoard = minimumFirstBoard;
-        this->_secondBoard = minimumSecondBoard;
     }
 
     void BitsetOneToOneGame::resetTransformation() {
-        switch (this->_rotations % 4) {
-            case 1:
-            case -3:
-                this->rotate270();
-                break;
-            case 2:
-            case -2:
-                this->rotate180();
-                break;
-            case 3:
-            case -1:
-                this->rotate90();
-                break;
-        }
-        if (this->_mirrored) {
-            this->mirrorHorizontal();
-        }
+        this->_mirrored = false;
+        this->_rotations = 0;
     }
 
     void BitsetOneToOneGame::mirrored() {
         this->_mirrored = !this->_mirrored;
-        this->_rotations = -this->_rotations;
+        this->_rotations = (4 - this->_rotations) % 4;
     }
 
     void BitsetOneToOneGame::rotated(int rotations) {
         this->_rotations = (this->_rotations + rotations) % 4;
     }
 
-    BitsetMove BitsetOneToOneGame::normalizeMove(const BitsetMove &move) const {
-        auto board = move.toBoard(this->_size);
-        switch (this->_rotations % 4) {
-            case 1:
-                board = board.rotate270();
-                break;
-            case 2:
-                board = board.rotate180();
-                break;
-            case 3:
-                board = board.rotate90();
-                break;
+    unsigned int BitsetOneToOneGame::orientation() const {
+        return (this->_mirrored ? 4 : 0) + this->_rotations;
+    }
+
+    BitsetBoard BitsetOneToOneGame::viewBoard(const BitsetBoard &board) const {
+        return this->orientedBoard(board, orientationTables().views[this->_size][this->orientation()]);
+    }
+
+    BitsetBoard BitsetOneToOneGame::cellBoard(const BitsetBoard &board) const {
+        return this->orientedBoard(board, orientationTables().cells[this->_size][this->orientation()]);
+    }
+
+    BitsetBoard BitsetOneToOneGame::orientedBoard(const BitsetBoard &board,
+                                                  const std::array<unsigned char, 140> &table) const {
+        if (this->orientation() == 0) {
+            return board;
         }
-        if (this->_mirrored) {
-            board = board.mirrorHorizontal();
+        std::bitset<CellCount> bitset = {};
+        auto words = board.words();
+        for (unsigned int i = 0; i < words.size(); i++) {
+            for (auto word = words[i]; word != 0; word &= word - 1) {
+                bitset.set(table[i * 64 + std::countr_zero(word)]);
+            }
         }
-        return BitsetMove::fromBoard(board).front();
+        return BitsetBoard(this->_size, bitset);
     }
 
-    BitsetMove BitsetOneToOneGame::transformMove(const BitsetMove &move) const {
-        auto board = move.toBoard(this->_size);
-        switch (this->_rotations % 4) {
-            case 1:
-                board = board.rotate90();
-                break;
-            case 2:
-                board = board.rotate180();
-                break;
-            case 3:
-                board = board.rotate270();
-                break;
+    unsigned int BitsetOneToOneGame::viewOffset(unsigned int cellOffset) const {
+        if (cellOffset >= CellCount) {
+            return cellOffset;
         }
-        if (this->_mirrored) {
-            board = board.mirrorHorizontal();
+        return orientationTables().views[this->_size][this->orientation()][cellOffset];
+    }
+
+    unsigned int BitsetOneToOneGame::cellOffset(unsigned int viewOffset) const {
+        if (viewOffset >= CellCount) {
+            return viewOffset;
         }
-        return BitsetMove::fromBoard(board).front();
+        return orientationTables().cells[this->_size][this->orientation()][viewOffset];
     }
-}
\ No newline at end of file
+}
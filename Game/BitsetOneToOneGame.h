@@ -1,7 +1,10 @@
 #ifndef MOSAICGAME_BITSETONETOONEGAME_H
 #define MOSAICGAME_BITSETONETOONEGAME_H
 
+#include <array>
 #include "OneToOneGame.h"
+#include "BitsetPosition.h"
+#include "MoveHistory.h"
 #include "Move/BitsetMove.h"
 #include "../Board/BitsetBoard.h"
 
@@ -9,93 +12,115 @@ using MosaicGame::Board::BitsetBoard;
 using MosaicGame::Game::Move::BitsetMove;
 
 namespace MosaicGame::Game {
-    class BitsetOneToOneGame : public OneToOneGame<BitsetBoard, BitsetMove> {
+    class BitsetOneToOneGame {
     public:
+        using BoardType = BitsetBoard;
+
+        using MoveType = BitsetMove;
+
         explicit BitsetOneToOneGame(unsigned char size, std::vector<BitsetMove> moves, bool mirrored, short rotations);
 
         explicit BitsetOneToOneGame(unsigned char size);
 
-        [[nodiscard]] unsigned char size() const override;
+        // Copies share the move history with the original, so only the boards are duplicated.
+        BitsetOneToOneGame(const BitsetOneToOneGame &other) = default;
+
+        BitsetOneToOneGame &operator=(const BitsetOneToOneGame &other) = default;
+
+        [[nodiscard]] unsigned char size() const;
+
+        [[nodiscard]] unsigned short piecesPerPlayer() const;
+
+        [[nodiscard]] unsigned short movesMade() const;
+
+        [[nodiscard]] std::vector<BitsetMove> moves() const;
+
+        [[nodiscard]] std::vector<BitsetMove> legalMoves() const;
+
+        [[nodiscard]] bool isOver() const;
 
-        [[nodiscard]] unsigned short piecesPerPlayer() const override;
+        [[nodiscard]] unsigned short firstScore() const;
 
-        [[nodiscard]] unsigned short movesMade() const override;
+        [[nodiscard]] unsigned short secondScore() const;
 
-        [[nodiscard]] std::vector<BitsetMove> moves() const override;
+        [[nodiscard]] unsigned short playerScore() const;
 
-        [[nodiscard]] std::vector<BitsetMove> legalMoves() const override;
+        [[nodiscard]] unsigned short opponentScore() const;
 
-        [[nodiscard]] bool isOver() const override;
+        [[nodiscard]] bool firstWins() const;
 
-        [[nodiscard]] unsigned short firstScore() const override;
+        [[nodiscard]] bool secondWins() const;
 
-        [[nodiscard]] unsigned short secondScore() const override;
+        [[nodiscard]] bool playerWins() const;
 
-        [[nodiscard]] unsigned short playerScore() const override;
+        [[nodiscard]] bool opponentWins() const;
 
-        [[nodiscard]] unsigned short opponentScore() const override;
+        [[nodiscard]] bool isFirstTurn() const;
 
-        [[nodiscard]] bool firstWins() const override;
+        [[nodiscard]] bool isSecondTurn() const;
 
-        [[nodiscard]] bool secondWins() const override;
+        [[nodiscard]] bool isLegalMove(const BitsetMove &move) const;
 
-        [[nodiscard]] bool playerWins() const override;
+        [[nodiscard]] BitsetBoard firstBoard() const;
 
-        [[nodiscard]] bool opponentWins() const override;
+        [[nodiscard]] BitsetBoard secondBoard() const;
 
-        [[nodiscard]] bool isFirstTurn() const override;
+        [[nodiscard]] BitsetBoard playerBoard() const;
 
-        [[nodiscard]] bool isSecondTurn() const override;
+        [[nodiscard]] BitsetBoard opponentBoard() const;
 
-        [[nodiscard]] bool isLegalMove(const BitsetMove &move) const override;
+        [[nodiscard]] BitsetBoard neutralBoard() const;
 
-        [[nodiscard]] BitsetBoard firstBoard() const override;
+        [[nodiscard]] BitsetBoard legalBoard() const;
 
-        [[nodiscard]] BitsetBoard secondBoard() const override;
+        [[nodiscard]] BitsetPosition position() const;
 
-        [[nodiscard]] BitsetBoard playerBoard() const override;
+        [[nodiscard]] bool isUndoable() const;
 
-        [[nodiscard]] BitsetBoard opponentBoard() const override;
+        [[nodiscard]] bool isRedoable() const;
 
-        [[nodiscard]] BitsetBoard neutralBoard() const override;
+        [[nodiscard]] std::size_t state() const;
 
-        [[nodiscard]] BitsetBoard legalBoard() const override;
+        GameStatus tryMakeMove(const BitsetMove &move);
 
-        [[nodiscard]] bool isUndoable() const override;
+        GameStatus tryUndo();
 
-        [[nodiscard]] bool isRedoable() const override;
+        GameStatus tryRedo();
 
-        [[nodiscard]] std::size_t state() const override;
+        void makeMove(const BitsetMove &move);
 
-        void makeMove(const BitsetMove &move) override;
+        // Starts a new game of the given size in place, keeping the object for reuse.
+        void reset(unsigned char size);
 
-        void undo() override;
+        void undo();
 
-        void redo() override;
+        void redo();
 
-        void flipVertical() override;
+        void flipVertical();
 
-        void mirrorHorizontal() override;
+        void mirrorHorizontal();
 
-        void flipDiagonal() override;
+        void flipDiagonal();
 
-        void rotate90() override;
+        void rotate90();
 
-        void rotate180() override;
+        void rotate180();
 
-        void rotate270() override;
+        void rotate270();
 
-        void transform() override;
+        void transform();
 
-        void resetTransformation() override;
+        void resetTransformation();
 
     private:
-        const unsigned char _size;
+        unsigned char _size;
+        // The boards and moves stay in the orientation the game started in. _mirrored and _rotations only
+        // change how boards and moves are shown, and are applied at the public interface.
         BitsetBoard _firstBoard;
         BitsetBoard _secondBoard;
         BitsetBoard _neutralBoard;
         BitsetBoard _groundBoard;
-        std::vector<BitsetMove> _moves;
+        MoveHistory<BitsetMove> _moves;
         unsigned int _undoCount;
         unsigned short _piecesPerPlayer;
         bool _mirrored;
@@ -116,14 +141,31 @@ namespace MosaicGame::Game {
 
         [[nodiscard]] BitsetBoard scaffoldedBoard() const;
 
-        [[nodiscard]] BitsetMove normalizeMove(const BitsetMove &move) const;
-
-        [[nodiscard]] BitsetMove transformMove(const BitsetMove &move) const;
+        [[nodiscard]] BitsetBoard cellLegalBoard() const;
 
         void mirrored();
 
         void rotated(int rotations);
+
+        [[nodiscard]] unsigned int orientation() const;
+
+        // The stored board as shown in the current orientation.
+        [[nodiscard]] BitsetBoard viewBoard(const BitsetBoard &board) const;
+
+        // The shown board as stored.
+        [[nodiscard]] BitsetBoard cellBoard(const BitsetBoard &board) const;
+
+        [[nodiscard]] BitsetBoard orientedBoard(const BitsetBoard &board,
+                                                const std::array<unsigned char, 140> &table) const;
+
+        // Where the stored cell is shown.
+        [[nodiscard]] unsigned int viewOffset(unsigned int cellOffset) const;
+
+        // The stored cell shown at the given offset.
+        [[nodiscard]] unsigned int cellOffset(unsigned int viewOffset) const;
     };
+
+    static_assert(OneToOneGame<BitsetOneToOneGame>);
 }
 
 #endif //MOSAICGAME_BITSETONETOONEGAME_H
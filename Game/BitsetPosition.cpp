@@ -0,0 +1,200 @@
+#include "BitsetPosition.h"
+
+#include <utility>
+#include <vector>
+#include "../Instrumentation/Instrumentation.h"
+
+namespace MosaicGame::Game {
+
+    BitsetPosition::BitsetPosition(const BitsetBoard &firstBoard, const BitsetBoard &secondBoard,
+                                   const BitsetBoard &neutralBoard, bool firstTurn) :
+            _firstBoard(firstBoard),
+            _secondBoard(secondBoard),
+            _neutralBoard(neutralBoard),
+            _groundBoard(BitsetBoard::groundBoard(firstBoard.size())),
+            _piecesPerPlayer(BitsetBoard::emptyBoard(firstBoard.size()).flip().count() / 2),
+            _firstTurn(firstTurn) {}
+
+    BitsetPosition::BitsetPosition(unsigned char size) :
+            BitsetPosition(
+                    BitsetBoard::emptyBoard(size),
+                    BitsetBoard::emptyBoard(size),
+                    BitsetBoard::neutralBoard(size),
+                    true
+            ) {}
+
+    unsigned char BitsetPosition::size() const {
+        return this->_firstBoard.size();
+    }
+
+    unsigned short BitsetPosition::piecesPerPlayer() const {
+        return this->_piecesPerPlayer;
+    }
+
+    bool BitsetPosition::isFirstTurn() const {
+        return this->_firstTurn;
+    }
+
+    bool BitsetPosition::isSecondTurn() const {
+        return !this->_firstTurn;
+    }
+
+    bool BitsetPosition::isOver() const {
+        return this->firstWins() || this->secondWins();
+    }
+
+    bool BitsetPosition::firstWins() const {
+        return this->_piecesPerPlayer <= this->_firstBoard.count();
+    }
+
+    bool BitsetPosition::secondWins() const {
+        return this->_piecesPerPlayer <= this->_secondBoard.count();
+    }
+
+    bool BitsetPosition::isLegalMove(const BitsetMove &move) const {
+        return (this->legalBoard() & move.toBoard(this->size())).count() > 0;
+    }
+
+    bool BitsetPosition::isStable() const {
+        auto majorityBoard = this->_firstBoard.promoteMajority() | this->_secondBoard.promoteMajority();
+        return (this->legalBoard() & majorityBoard).count() == 0;
+    }
+
+    BitsetBoard BitsetPosition::firstBoard() const {
+        return this->_firstBoard;
+    }
+
+    BitsetBoard BitsetPosition::secondBoard() const {
+        return this->_secondBoard;
+    }
+
+    BitsetBoard BitsetPosition::neutralBoard() const {
+        return this->_neutralBoard;
+    }
+
+    BitsetBoard BitsetPosition::legalBoard() const {
+        MOSAICGAME_COUNT(LegalBoards, 1);
+        auto occupiedBoard = this->occupiedBoard();
+        return occupiedBoard.flip() & (this->_groundBoard | occupiedBoard.promoteFour());
+    }
+
+    BitsetBoard BitsetPosition::occupiedBoard() const {
+        return this->_neutralBoard | this->_firstBoard | this->_secondBoard;
+    }
+
+    bool BitsetPosition::operator==(const BitsetPosition &other) const {
+        return this->_firstTurn == other._firstTurn
+               && this->_firstBoard == other._firstBoard
+               && this->_secondBoard == other._secondBoard
+               && this->_neutralBoard == other._neutralBoard;
+    }
+
+    BitsetPosition BitsetPosition::successor(const BitsetMove &move) const {
+        auto position = *this;
+        position.handleMove(move);
+        position._firstTurn = !this->_firstTurn;
+        return position;
+    }
+
+    std::vector<std::pair<BitsetPosition, BitsetMove>> BitsetPosition::predecessors() const {
+        std::vector<std::pair<BitsetPosition, BitsetMove>> predecessors = {};
+        auto moverBoard = this->_firstTurn ? this->_secondBoard : this->_firstBoard;
+        auto pieceBoard = this->_firstBoard | this->_secondBoard;
+        for (const auto &move : BitsetMove::fromBoard(moverBoard)) {
+            // Chained pieces always rest on the placed piece or on other chained pieces, and nothing
+            // placed earlier may rest on them, so the unmade set is exactly the placed piece's upward closure.
+            auto removedBoard = move.toBoard(this->size());
+            while (true) {
+                auto closureBoard = removedBoard | (pieceBoard & this->supportedBoard(removedBoard));
+                if (closureBoard == removedBoard) {
+                    break;
+                }
+                removedBoard = closureBoard;
+            }
+
+            auto predecessor = BitsetPosition(
+                    this->_firstBoard ^ (this->_firstBoard & removedBoard),
+                    this->_secondBoard ^ (this->_secondBoard & removedBoard),
+                    this->_neutralBoard,
+                    !this->_firstTurn
+            );
+            if (predecessor.isOver() || !predecessor.isLegalMove(move) || !predecessor.isStable()) {
+                continue;
+            }
+            if (predecessor.successor(move) == *this) {
+                predecessors.emplace_back(predecessor, move);
+            }
+        }
+        return predecessors;
+    }
+
+    void BitsetPosition::handleMove(const BitsetMove &move) {
+
+        if (this->_firstTurn) {
+            this->_firstBoard = this->_firstBoard | move.toBoard(this->size());
+        } else {
+            this->_secondBoard = this->_secondBoard | move.toBoard(this->size());
+        }
+
+#ifdef MOSAICGAME_INSTRUMENTATION
+        const auto placedPieces = this->_firstBoard.count() + this->_secondBoard.count();
+#endif
+        auto legalBoard = this->legalBoard();
+        auto firstMajorityBoard = this->_firstBoard.promoteMajority();
+        auto secondMajorityBoard = this->_secondBoard.promoteMajority();
+
+        do {
+            auto chained = false;
+            BitsetBoard firstChainBoard = legalBoard & firstMajorityBoard;
+            if (firstChainBoard.count()) {
+                auto firstVacancy = this->_piecesPerPlayer - this->_firstBoard.count();
+                if (firstChainBoard.count() <= firstVacancy) {
+                    this->_firstBoard = this->_firstBoard | firstChainBoard;
+                } else {
+                    for (unsigned int i = 0; i < firstVacancy; i++) {
+                        auto chainMove = BitsetMove::nthFromBoard(firstChainBoard, i);
+                        this->_firstBoard = this->_firstBoard | chainMove.toBoard(this->size());
+                    }
+                }
+                chained = true;
+                legalBoard = this->legalBoard();
+                firstMajorityBoard = this->_firstBoard.promoteMajority();
+            }
+
+            BitsetBoard secondChainBoard = legalBoard & secondMajorityBoard;
+            if (secondChainBoard.count()) {
+                auto secondVacancy = this->_piecesPerPlayer - this->_secondBoard.count();
+                if (secondChainBoard.count() <= secondVacancy) {
+                    this->_secondBoard = this->_secondBoard | secondChainBoard;
+                } else {
+                    for (unsigned int i = 0; i < secondVacancy; i++) {
+                        auto chainMove = BitsetMove::nthFromBoard(secondChainBoard, i);
+                        this->_secondBoard = this->_secondBoard | chainMove.toBoard(this->size());
+                    }
+                }
+                chained = true;
+                legalBoard = this->legalBoard();
+                secondMajorityBoard = this->_secondBoard.promoteMajority();
+            }
+
+            if (!chained) {
+                break;
+            }
+            MOSAICGAME_COUNT(ChainIterations, 1);
+        } while (!this->isOver());
+
+#ifdef MOSAICGAME_INSTRUMENTATION
+        auto chainedPieces = this->_firstBoard.count() + this->_secondBoard.count() - placedPieces;
+        if (chainedPieces > 0) {
+            MOSAICGAME_COUNT(ChainedMoves, 1);
+            MOSAICGAME_COUNT(ChainedPieces, chainedPieces);
+        }
+        MOSAICGAME_RECORD("chainLength", "pieces", chainedPieces);
+#endif
+    }
+
+    BitsetBoard BitsetPosition::supportedBoard(const BitsetBoard &board) const {
+        auto upperBoard = this->_groundBoard.flip();
+        return upperBoard ^ board.promoteZero();
+    }
+}
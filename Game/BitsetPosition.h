@@ -0,0 +1,77 @@
+#ifndef MOSAICGAME_BITSETPOSITION_H
+#define MOSAICGAME_BITSETPOSITION_H
+
+#include <utility>
+#include <vector>
+#include "Position.h"
+#include "Move/BitsetMove.h"
+#include "../Board/BitsetBoard.h"
+
+using MosaicGame::Board::BitsetBoard;
+using MosaicGame::Game::Move::BitsetMove;
+
+namespace MosaicGame::Game {
+    class BitsetPosition {
+    public:
+        using BoardType = BitsetBoard;
+
+        using MoveType = BitsetMove;
+
+        explicit BitsetPosition(const BitsetBoard &firstBoard, const BitsetBoard &secondBoard,
+                                const BitsetBoard &neutralBoard, bool firstTurn);
+
+        explicit BitsetPosition(unsigned char size);
+
+        [[nodiscard]] unsigned char size() const;
+
+        [[nodiscard]] unsigned short piecesPerPlayer() const;
+
+        [[nodiscard]] bool isFirstTurn() const;
+
+        [[nodiscard]] bool isSecondTurn() const;
+
+        [[nodiscard]] bool isOver() const;
+
+        [[nodiscard]] bool firstWins() const;
+
+        [[nodiscard]] bool secondWins() const;
+
+        [[nodiscard]] bool isLegalMove(const BitsetMove &move) const;
+
+        [[nodiscard]] bool isStable() const;
+
+        [[nodiscard]] BitsetBoard firstBoard() const;
+
+        [[nodiscard]] BitsetBoard secondBoard() const;
+
+        [[nodiscard]] BitsetBoard neutralBoard() const;
+
+        [[nodiscard]] BitsetBoard legalBoard() const;
+
+        [[nodiscard]] BitsetBoard occupiedBoard() const;
+
+        [[nodiscard]] bool operator==(const BitsetPosition &other) const;
+
+        // Places the move for the side to move and resolves chains. Legality is not checked.
+        [[nodiscard]] BitsetPosition successor(const BitsetMove &move) const;
+
+        // Every non-over, stable position and legal move whose successor is this position.
+        [[nodiscard]] std::vector<std::pair<BitsetPosition, BitsetMove>> predecessors() const;
+
+    private:
+        BitsetBoard _firstBoard;
+        BitsetBoard _secondBoard;
+        BitsetBoard _neutralBoard;
+        BitsetBoard _groundBoard;
+        unsigned short _piecesPerPlayer;
+        bool _firstTurn;
+
+        void handleMove(const BitsetMove &move);
+
+        [[nodiscard]] BitsetBoard supportedBoard(const BitsetBoard &board) const;
+    };
+
+    static_assert(Position<BitsetPosition>);
+}
+
+#endif //MOSAICGAME_BITSETPOSITION_H
@@ -0,0 +1,374 @@
+#include "BitsetPositionClassRanking.h"
+
+#include <algorithm>
+#include <bit>
+#include <bitset>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+namespace MosaicGame::Game {
+
+    BitsetPositionClassRanking::BitsetPositionClassRanking(unsigned char size) :
+            _size(size),
+            _piecesPerPlayer(BitsetBoard::emptyBoard(size).flip().count() / 2),
+            _neutral(0),
+            _images(8 * 7),
+            _subgroups{},
+            _orbits{},
+            _occupancies{},
+            _classOffsets{0},
+            _binomialSums{} {
+        if (size < 1 || size > 5) {
+            throw std::runtime_error("Position ranking exceeds 64 bits beyond size 5.");
+        }
+        this->_neutral = BitsetBoard::neutralBoard(size).words()[0];
+
+        // The symmetries in the order BitsetPositionRanking::canonicalize() visits them.
+        auto cells = Board::pyramidCells(size);
+        for (unsigned int offset = 0; offset < cells; offset++) {
+            auto board = BitsetBoard(size, std::bitset<140>(1) << offset);
+            for (unsigned int symmetry = 0; symmetry < 8; symmetry++) {
+                auto target = std::countr_zero(board.words()[0]);
+                for (unsigned int value = 0; value < 256; value++) {
+                    if ((value >> (offset % 8)) & 1) {
+                        this->_images[symmetry * 7 + offset / 8][value] |= 1ULL << target;
+                    }
+                }
+                board = symmetry == 3 ? board.mirrorHorizontal() : board.rotate90();
+            }
+        }
+
+        auto composed = [this, cells](unsigned int first, unsigned int second) {
+            for (unsigned int product = 0; product < 8; product++) {
+                auto same = true;
+                for (unsigned int cell = 0; cell < cells && same; cell++) {
+                    same = this->image(first, this->image(second, 1ULL << cell)) == this->image(product, 1ULL << cell);
+                }
+                if (same) {
+                    return product;
+                }
+            }
+            return 0u;
+        };
+        for (unsigned int symmetries = 1; symmetries < 256; symmetries += 2) {
+            auto closed = true;
+            for (unsigned int first = 0; first < 8; first++) {
+                for (unsigned int second = 0; second < 8; second++) {
+                    if (((symmetries >> first) & 1) && ((symmetries >> second) & 1)
+                        && !((symmetries >> composed(first, second)) & 1)) {
+                        closed = false;
+                    }
+                }
+            }
+            if (closed) {
+                this->_subgroups.emplace_back(symmetries);
+            }
+        }
+        for (auto group: this->_subgroups) {
+            std::vector<Orbit> orbits = {};
+            unsigned long long seen = 0;
+            for (unsigned int cell = 0; cell < cells; cell++) {
+                if (!((seen >> cell) & 1)) {
+                    orbits.emplace_back(this->orbit(group, cell));
+                    seen |= orbits.back().cells;
+                }
+            }
+            this->_orbits.emplace_back(std::move(orbits));
+        }
+
+        std::vector<unsigned long long> binomials = {1};
+        for (unsigned int n = 0; n <= 2u * this->_piecesPerPlayer; n++) {
+            std::vector<unsigned long long> sums = {0};
+            for (auto binomial: binomials) {
+                sums.emplace_back(sums.back() + binomial);
+            }
+            this->_binomialSums.emplace_back(sums);
+            binomials.emplace_back(0);
+            for (auto k = n + 1; k > 0; k--) {
+                binomials[k] += binomials[k - 1];
+            }
+        }
+
+        this->collect(size - 1, this->_neutral);
+        std::sort(this->_occupancies.begin(), this->_occupancies.end());
+        for (auto occupancy: this->_occupancies) {
+            Completions memo = {};
+            auto orbits = this->orbits(occupancy);
+            auto classes = this->completions(orbits, 0, this->subgroup(orbits.stabilizer), 0, memo);
+            this->_classOffsets.emplace_back(this->_classOffsets.back() + classes);
+        }
+    }
+
+    unsigned char BitsetPositionClassRanking::size() const {
+        return this->_size;
+    }
+
+    unsigned long long BitsetPositionClassRanking::count() const {
+        return this->_classOffsets.back();
+    }
+
+    unsigned long long BitsetPositionClassRanking::rank(const BitsetPosition &position) const {
+        auto first = position.firstBoard().words()[0];
+        auto second = position.secondBoard().words()[0];
+        auto occupied = first | second;
+        if ((first & second) != 0
+            || (occupied & this->_neutral) != 0
+            || position.neutralBoard().words()[0] != this->_neutral
+            || !this->isValidColouring(std::popcount(occupied), std::popcount(first))) {
+            throw std::runtime_error("The position is not a valid placement configuration.");
+        }
+
+        // Move the position onto its canonical occupancy; the symmetries doing so differ by the stabilizer.
+        auto occupancy = occupied;
+        auto canonicalFirst = first;
+        for (unsigned int symmetry = 1; symmetry < 8; symmetry++) {
+            auto image = this->image(symmetry, occupied);
+            if (image < occupancy) {
+                occupancy = image;
+                canonicalFirst = this->image(symmetry, first);
+            }
+        }
+        auto found = std::lower_bound(this->_occupancies.begin(), this->_occupancies.end(), occupancy);
+        if (found == this->_occupancies.end() || *found != occupancy) {
+            throw std::runtime_error("The position is not a valid placement configuration.");
+        }
+
+        auto orbits = this->orbits(occupancy);
+        auto states = this->states(orbits, canonicalFirst);
+        for (unsigned int symmetry = 1; symmetry < 8; symmetry++) {
+            if ((orbits.stabilizer >> symmetry) & 1) {
+                states = std::min(states, this->states(orbits, this->image(symmetry, canonicalFirst)));
+            }
+        }
+
+        Completions memo = {};
+        unsigned long long colouringRank = 0;
+        auto tied = this->subgroup(orbits.stabilizer);
+        unsigned int firstPieces = 0;
+        for (unsigned int i = 0; i < orbits.orbits.size(); i++) {
+            const auto &tiedAfter = orbits.orbits[i]->tiedAfter[tied];
+            for (unsigned int state = 0; state < states[i]; state++) {
+                if (tiedAfter[state] >= 0) {
+                    colouringRank += this->completions(orbits, i + 1, tiedAfter[state],
+                                                       firstPieces + std::popcount(state), memo);
+                }
+            }
+            tied = tiedAfter[states[i]];
+            firstPieces += std::popcount(states[i]);
+        }
+
+        return this->_classOffsets[found - this->_occupancies.begin()] + colouringRank;
+    }
+
+    BitsetPosition BitsetPositionClassRanking::unrank(unsigned long long index, bool firstTurn) const {
+        if (index >= this->count()) {
+            throw std::runtime_error("The index is out of range.");
+        }
+
+        auto found = std::upper_bound(this->_classOffsets.begin(), this->_classOffsets.end(), index) - 1;
+        auto occupancy = this->_occupancies[found - this->_classOffsets.begin()];
+        auto colouringRank = index - *found;
+
+        auto orbits = this->orbits(occupancy);
+        Completions memo = {};
+        unsigned long long first = 0;
+        auto tied = this->subgroup(orbits.stabilizer);
+        unsigned int firstPieces = 0;
+        for (unsigned int i = 0; i < orbits.orbits.size(); i++) {
+            const auto &orbit = *orbits.orbits[i];
+            for (unsigned int state = 0;; state++) {
+                auto next = orbit.tiedAfter[tied][state];
+                if (next < 0) {
+                    continue;
+                }
+                auto completions = this->completions(orbits, i + 1, next, firstPieces + std::popcount(state), memo);
+                if (colouringRank < completions) {
+                    for (unsigned int member = 0; member < orbit.members.size(); member++) {
+                        if ((state >> member) & 1) {
+                            first |= 1ULL << orbit.members[member];
+                        }
+                    }
+                    tied = next;
+                    firstPieces += std::popcount(state);
+                    break;
+                }
+                colouringRank -= completions;
+            }
+        }
+
+        return BitsetPosition(
+                BitsetBoard(this->_size, std::bitset<140>(first)),
+                BitsetBoard(this->_size, std::bitset<140>(occupancy ^ first)),
+                BitsetBoard::neutralBoard(this->_size),
+                firstTurn
+        );
+    }
+
+    void BitsetPositionClassRanking::collect(int layer, unsigned long long occupied) {
+        if (layer < 0) {
+            auto occupancy = occupied & ~this->_neutral;
+            if ((unsigned int) std::popcount(occupancy) > 2u * this->_piecesPerPlayer) {
+                return;
+            }
+            for (unsigned int symmetry = 1; symmetry < 8; symmetry++) {
+                if (this->image(symmetry, occupancy) < occupancy) {
+                    return;
+                }
+            }
+            this->_occupancies.emplace_back(occupancy);
+            return;
+        }
+
+        // Ground cells are free apart from the neutral piece; a cell above needs its four supports occupied.
+        unsigned long long free = 0;
+        for (auto offset = Board::pyramidCells(layer); offset < Board::pyramidCells(layer + 1); offset++) {
+            auto supports = layer + 1 == this->_size ? 0 : Board::BitsetCellGeometry::cell(offset).supportMask[0];
+            if ((supports & ~occupied) == 0) {
+                free |= 1ULL << offset;
+            }
+        }
+        free &= ~this->_neutral;
+        for (auto sub = free;; sub = (sub - 1) & free) {
+            this->collect(layer - 1, occupied | sub);
+            if (sub == 0) {
+                break;
+            }
+        }
+    }
+
+    unsigned long long BitsetPositionClassRanking::image(unsigned int symmetry, unsigned long long cells) const {
+        unsigned long long image = 0;
+        for (unsigned int byte = 0; byte < 7; byte++) {
+            image |= this->_images[symmetry * 7 + byte][(cells >> (byte * 8)) & 0xff];
+        }
+        return image;
+    }
+
+    unsigned int BitsetPositionClassRanking::subgroup(unsigned int symmetries) const {
+        return std::find(this->_subgroups.begin(), this->_subgroups.end(), symmetries) - this->_subgroups.begin();
+    }
+
+    BitsetPositionClassRanking::Orbit BitsetPositionClassRanking::orbit(unsigned int group, unsigned int cell) const {
+        Orbit orbit = {};
+        for (unsigned int symmetry = 0; symmetry < 8; symmetry++) {
+            if ((group >> symmetry) & 1) {
+                orbit.cells |= this->image(symmetry, 1ULL << cell);
+            }
+        }
+        for (auto members = orbit.cells; members != 0; members &= members - 1) {
+            orbit.members.emplace_back(std::countr_zero(members));
+        }
+
+        // images[symmetry][state] is the state the symmetry moves the orbit's state to.
+        auto states = 1u << orbit.members.size();
+        std::vector<std::vector<unsigned int>> images(8, std::vector<unsigned int>(states, 0));
+        for (unsigned int symmetry = 0; symmetry < 8; symmetry++) {
+            if (!((group >> symmetry) & 1)) {
+                continue;
+            }
+            for (unsigned int member = 0; member < orbit.members.size(); member++) {
+                auto target = std::countr_zero(this->image(symmetry, 1ULL << orbit.members[member]));
+                auto targetMember = std::find(orbit.members.begin(), orbit.members.end(), target)
+                                    - orbit.members.begin();
+                for (unsigned int state = 0; state < states; state++) {
+                    images[symmetry][state] |= ((state >> member) & 1) << targetMember;
+                }
+            }
+        }
+
+        // Only subgroups of the group are ever tied on its orbits.
+        for (auto tied: this->_subgroups) {
+            std::vector<signed char> tiedAfter(states, -1);
+            std::map<std::pair<unsigned char, unsigned char>, unsigned long long> transitions = {};
+            for (unsigned int state = 0; state < states && (tied & ~group) == 0; state++) {
+                auto next = tied;
+                for (unsigned int symmetry = 0; symmetry < 8 && next != 0; symmetry++) {
+                    if (!((tied >> symmetry) & 1) || images[symmetry][state] == state) {
+                        continue;
+                    }
+                    next = images[symmetry][state] < state ? 0 : next & ~(1u << symmetry);
+                }
+                if (next != 0) {
+                    tiedAfter[state] = (signed char) this->subgroup(next);
+                    transitions[{(unsigned char) tiedAfter[state], (unsigned char) std::popcount(state)}]++;
+                }
+            }
+            orbit.tiedAfter.emplace_back(std::move(tiedAfter));
+            orbit.transitions.emplace_back();
+            for (const auto &[key, count]: transitions) {
+                orbit.transitions.back().emplace_back(Transition{key.first, key.second, count});
+            }
+        }
+        return orbit;
+    }
+
+    BitsetPositionClassRanking::Orbits BitsetPositionClassRanking::orbits(unsigned long long occupancy) const {
+        Orbits orbits = {};
+        for (unsigned int symmetry = 0; symmetry < 8; symmetry++) {
+            if (this->image(symmetry, occupancy) == occupancy) {
+                orbits.stabilizer |= 1u << symmetry;
+            }
+        }
+        // The occupancy is a union of orbits of its stabilizer.
+        for (const auto &orbit: this->_orbits[this->subgroup(orbits.stabilizer)]) {
+            if ((orbit.cells & occupancy) != 0) {
+                orbits.orbits.emplace_back(&orbit);
+            }
+        }
+        orbits.pieces.resize(orbits.orbits.size() + 1, 0);
+        for (auto i = orbits.orbits.size(); i > 0; i--) {
+            orbits.pieces[i - 1] = orbits.pieces[i] + orbits.orbits[i - 1]->members.size();
+        }
+        return orbits;
+    }
+
+    std::vector<unsigned int> BitsetPositionClassRanking::states(const Orbits &orbits, unsigned long long first) const {
+        std::vector<unsigned int> states = {};
+        for (const auto orbit: orbits.orbits) {
+            unsigned int state = 0;
+            for (unsigned int member = 0; member < orbit->members.size(); member++) {
+                state |= ((first >> orbit->members[member]) & 1) << member;
+            }
+            states.emplace_back(state);
+        }
+        return states;
+    }
+
+    unsigned long long BitsetPositionClassRanking::completions(const Orbits &orbits, unsigned int index,
+                                                               unsigned int tied, unsigned int firstPieces,
+                                                               Completions &memo) const {
+        // Once only the identity is tied, every colouring of the rest keeps the whole one canonical.
+        if (tied == 0 || index == orbits.orbits.size()) {
+            return this->colourings(orbits.pieces[0], orbits.pieces[index], firstPieces);
+        }
+
+        auto key = (index << 16) | (tied << 8) | firstPieces;
+        if (memo.count(key)) {
+            return memo[key];
+        }
+        unsigned long long completions = 0;
+        for (const auto &transition: orbits.orbits[index]->transitions[tied]) {
+            completions += transition.states * this->completions(orbits, index + 1, transition.tied,
+                                                                 firstPieces + transition.firstPieces, memo);
+        }
+        return memo[key] = completions;
+    }
+
+    unsigned long long BitsetPositionClassRanking::colourings(unsigned int pieces, unsigned int remaining,
+                                                              unsigned int firstPieces) const {
+        // The first player needs at least pieces - piecesPerPlayer pieces and at most piecesPerPlayer.
+        if (firstPieces > this->_piecesPerPlayer || remaining + firstPieces + this->_piecesPerPlayer < pieces) {
+            return 0;
+        }
+        auto least = pieces > firstPieces + this->_piecesPerPlayer ? pieces - firstPieces - this->_piecesPerPlayer : 0;
+        auto most = std::min(remaining, this->_piecesPerPlayer - firstPieces);
+        return least > most ? 0 : this->_binomialSums[remaining][most + 1] - this->_binomialSums[remaining][least];
+    }
+
+    bool BitsetPositionClassRanking::isValidColouring(unsigned int pieces, unsigned int firstPieces) const {
+        return firstPieces <= pieces
+               && firstPieces <= this->_piecesPerPlayer
+               && pieces - firstPieces <= this->_piecesPerPlayer;
+    }
+}
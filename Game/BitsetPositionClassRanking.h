@@ -0,0 +1,97 @@
+#ifndef MOSAICGAME_BITSETPOSITIONCLASSRANKING_H
+#define MOSAICGAME_BITSETPOSITIONCLASSRANKING_H
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+#include "BitsetPosition.h"
+
+namespace MosaicGame::Game {
+    // Bijection between [0, count()) and the placement configurations of a size up to the eight board symmetries,
+    // so a retrograde table indexed by class needs no slots for symmetric duplicates. Classes are ordered by the
+    // canonical occupancy, the smallest of its eight images, then by colouring. The constructor lists the canonical
+    // occupancies in a sorted table: 18458 for size 4, about 14 million for size 5. Within an occupancy, the
+    // colourings are counted orbit by orbit under the symmetries that keep the occupancy in place.
+    class BitsetPositionClassRanking {
+    public:
+        explicit BitsetPositionClassRanking(unsigned char size);
+
+        [[nodiscard]] unsigned char size() const;
+
+        [[nodiscard]] unsigned long long count() const;
+
+        // Equal for every image of the position under the board symmetries.
+        [[nodiscard]] unsigned long long rank(const BitsetPosition &position) const;
+
+        // The canonical configuration of the class: its occupancy is the smallest of its images.
+        [[nodiscard]] BitsetPosition unrank(unsigned long long index, bool firstTurn) const;
+
+    private:
+        // States of an orbit allowed while a subgroup is tied, by the subgroup left tied and their first pieces.
+        struct Transition {
+            unsigned char tied;
+            unsigned char firstPieces;
+            unsigned long long states;
+        };
+
+        // Cells that a group of symmetries moves among each other. A state of the orbit has bit i set when the
+        // first player holds members[i]. Symmetries tied with the identity give the same colouring so far; a tied
+        // symmetry making a state smaller makes the whole colouring smaller, so the state is not canonical.
+        struct Orbit {
+            unsigned long long cells;
+            std::vector<unsigned int> members;
+            // By subgroup index: the subgroup still tied after each state, or -1 when the state is not canonical.
+            std::vector<std::vector<signed char>> tiedAfter;
+            std::vector<std::vector<Transition>> transitions;
+        };
+
+        // The orbits of an occupancy under its stabilizer, and the pieces in each orbit and the ones after it.
+        struct Orbits {
+            unsigned int stabilizer;
+            std::vector<const Orbit *> orbits;
+            std::vector<unsigned int> pieces;
+        };
+
+        using Completions = std::unordered_map<unsigned int, unsigned long long>;
+
+        const unsigned char _size;
+        unsigned short _piecesPerPlayer;
+        unsigned long long _neutral;
+        // Eight symmetries, seven bytes of cells, 256 byte values: the image of one byte of an occupancy.
+        std::vector<std::array<unsigned long long, 256>> _images;
+        // Sets of symmetries closed under composition, as masks; the identity alone comes first.
+        std::vector<unsigned int> _subgroups;
+        // By subgroup index: the orbits of every cell, by smallest member.
+        std::vector<std::vector<Orbit>> _orbits;
+        std::vector<unsigned long long> _occupancies;
+        std::vector<unsigned long long> _classOffsets;
+        // _binomialSums[n][k] is the number of subsets of n pieces with fewer than k of them.
+        std::vector<std::vector<unsigned long long>> _binomialSums;
+
+        void collect(int layer, unsigned long long occupied);
+
+        [[nodiscard]] unsigned long long image(unsigned int symmetry, unsigned long long cells) const;
+
+        [[nodiscard]] unsigned int subgroup(unsigned int symmetries) const;
+
+        [[nodiscard]] Orbit orbit(unsigned int group, unsigned int cell) const;
+
+        [[nodiscard]] Orbits orbits(unsigned long long occupancy) const;
+
+        [[nodiscard]] std::vector<unsigned int> states(const Orbits &orbits, unsigned long long first) const;
+
+        // Colourings of the orbits from index on that keep the whole colouring the smallest in its class, given
+        // the subgroup still tied with the identity and the first player's pieces so far.
+        [[nodiscard]] unsigned long long completions(const Orbits &orbits, unsigned int index, unsigned int tied,
+                                                     unsigned int firstPieces, Completions &memo) const;
+
+        // Valid colourings of pieces in all when the first player has firstPieces of the others and any of the
+        // remaining ones.
+        [[nodiscard]] unsigned long long colourings(unsigned int pieces, unsigned int remaining,
+                                                    unsigned int firstPieces) const;
+
+        [[nodiscard]] bool isValidColouring(unsigned int pieces, unsigned int firstPieces) const;
+    };
+}
+
+#endif //MOSAICGAME_BITSETPOSITIONCLASSRANKING_H
@@ -0,0 +1,469 @@
+#include "BitsetPositionRanking.h"
+
+#include <bit>
+#include <bitset>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace MosaicGame::Game {
+
+    BitsetPositionRanking::BitsetPositionRanking(unsigned char size) :
+            _size(size),
+            _piecesPerPlayer(BitsetBoard::emptyBoard(size).flip().count() / 2),
+            _neutralOffset(size % 2 == 1 ? (size / 2) * size + size / 2 : size * size),
+            _countOffsets{0},
+            _colourings{},
+            _completions{},
+            _classCount(0) {
+        if (size < 1 || size > 5) {
+            throw std::runtime_error("Position ranking exceeds 64 bits beyond size 5.");
+        }
+
+        const auto &ideals = this->completions(1, 0);
+        for (unsigned int pieces = 0; pieces < ideals.size(); pieces++) {
+            unsigned long long colourings = 0;
+            for (unsigned int firstPieces = 0; firstPieces <= pieces; firstPieces++) {
+                if (this->isValidColouring(pieces, firstPieces)) {
+                    colourings += BitsetPositionRanking::binomial(pieces, firstPieces);
+                }
+            }
+            this->_colourings.emplace_back(colourings);
+            this->_countOffsets.emplace_back(this->_countOffsets.back() + ideals[pieces] * colourings);
+        }
+
+        auto fixed = this->count();
+        for (unsigned int symmetry = 1; symmetry < 8; symmetry++) {
+            fixed += this->fixedConfigurations(symmetry);
+        }
+        this->_classCount = fixed / 8;
+    }
+
+    unsigned char BitsetPositionRanking::size() const {
+        return this->_size;
+    }
+
+    unsigned long long BitsetPositionRanking::count() const {
+        return this->_countOffsets.back();
+    }
+
+    unsigned long long BitsetPositionRanking::classCount() const {
+        return this->_classCount;
+    }
+
+    unsigned long long BitsetPositionRanking::rank(const BitsetPosition &position) const {
+        auto first = position.firstBoard().bitset();
+        auto second = position.secondBoard().bitset();
+        auto occupied = first | second;
+        auto firstPieces = static_cast<unsigned int>(first.count());
+        auto pieces = static_cast<unsigned int>(occupied.count());
+
+        if ((first & second).any()
+            || (occupied & position.neutralBoard().bitset()).any()
+            || !this->isValidColouring(pieces, firstPieces)) {
+            throw std::runtime_error("The position is not a valid placement configuration.");
+        }
+
+        unsigned long long occupancyRank = 0;
+        unsigned long long forced = 0;
+        auto remaining = pieces;
+        for (unsigned char layerSize = 1; layerSize < this->_size; layerSize++) {
+            auto layer = this->layer(occupied, layerSize);
+            if ((layer & forced) != forced) {
+                throw std::runtime_error("The position is not a valid placement configuration.");
+            }
+            auto free = ((1ULL << (layerSize * layerSize)) - 1) & ~forced;
+            auto actual = layer & free;
+            for (unsigned long long sub = 0; sub != actual; sub = ((sub | ~free) + 1) & free) {
+                auto candidate = forced | sub;
+                auto candidatePieces = static_cast<unsigned int>(std::popcount(candidate));
+                if (candidatePieces <= remaining) {
+                    occupancyRank += this->completions(
+                            layerSize + 1,
+                            this->shadow(layerSize, candidate),
+                            remaining - candidatePieces
+                    );
+                }
+            }
+            remaining -= std::popcount(layer);
+            forced = this->shadow(layerSize, layer);
+        }
+
+        auto ground = this->layer(occupied, this->_size);
+        auto neutral = this->groundNeutral();
+        if ((ground & forced & ~neutral) != (forced & ~neutral)) {
+            throw std::runtime_error("The position is not a valid placement configuration.");
+        }
+        unsigned int freeIndex = 0;
+        unsigned int chosen = 0;
+        for (unsigned int i = 0; i < this->_size * this->_size; i++) {
+            auto bit = 1ULL << i;
+            if ((forced | neutral) & bit) {
+                continue;
+            }
+            if (ground & bit) {
+                occupancyRank += BitsetPositionRanking::binomial(freeIndex, ++chosen);
+            }
+            freeIndex++;
+        }
+
+        unsigned long long colouringRank = 0;
+        for (unsigned int i = 0; i < firstPieces; i++) {
+            if (this->isValidColouring(pieces, i)) {
+                colouringRank += BitsetPositionRanking::binomial(pieces, i);
+            }
+        }
+        unsigned int pieceIndex = 0;
+        chosen = 0;
+        for (unsigned int offset = 0; offset < 140; offset++) {
+            if (!occupied.test(offset)) {
+                continue;
+            }
+            if (first.test(offset)) {
+                colouringRank += BitsetPositionRanking::binomial(pieceIndex, ++chosen);
+            }
+            pieceIndex++;
+        }
+
+        return this->_countOffsets[pieces] + occupancyRank * this->_colourings[pieces] + colouringRank;
+    }
+
+    BitsetPosition BitsetPositionRanking::unrank(unsigned long long index, bool firstTurn) const {
+        if (index >= this->count()) {
+            throw std::runtime_error("The index is out of range.");
+        }
+
+        unsigned int pieces = 0;
+        while (this->_countOffsets[pieces + 1] <= index) {
+            pieces++;
+        }
+        auto occupancyRank = (index - this->_countOffsets[pieces]) / this->_colourings[pieces];
+        auto colouringRank = (index - this->_countOffsets[pieces]) % this->_colourings[pieces];
+
+        auto occupied = std::bitset<140>(0);
+        unsigned long long forced = 0;
+        auto remaining = pieces;
+        for (unsigned char layerSize = 1; layerSize < this->_size; layerSize++) {
+            auto free = ((1ULL << (layerSize * layerSize)) - 1) & ~forced;
+            auto layer = forced;
+            for (unsigned long long sub = 0;; sub = ((sub | ~free) + 1) & free) {
+                layer = forced | sub;
+                auto layerPieces = static_cast<unsigned int>(std::popcount(layer));
+                auto completions = layerPieces <= remaining
+                                   ? this->completions(layerSize + 1, this->shadow(layerSize, layer),
+                                                       remaining - layerPieces)
+                                   : 0;
+                if (occupancyRank < completions) {
+                    break;
+                }
+                occupancyRank -= completions;
+            }
+            auto shift = BitsetPositionRanking::layerShift(layerSize);
+            for (unsigned int i = 0; i < layerSize * layerSize; i++) {
+                if ((layer >> i) & 1) {
+                    occupied.set(shift + i);
+                }
+            }
+            remaining -= std::popcount(layer);
+            forced = this->shadow(layerSize, layer);
+        }
+
+        auto neutral = this->groundNeutral();
+        auto ground = forced & ~neutral;
+        std::vector<unsigned int> freeCells = {};
+        for (unsigned int i = 0; i < this->_size * this->_size; i++) {
+            if (!(((forced | neutral) >> i) & 1)) {
+                freeCells.emplace_back(i);
+            }
+        }
+        auto freeIndex = static_cast<unsigned int>(freeCells.size());
+        for (auto chosen = remaining - std::popcount(ground); chosen > 0; chosen--) {
+            do {
+                freeIndex--;
+            } while (BitsetPositionRanking::binomial(freeIndex, chosen) > occupancyRank);
+            occupancyRank -= BitsetPositionRanking::binomial(freeIndex, chosen);
+            ground |= 1ULL << freeCells[freeIndex];
+        }
+        auto groundShift = BitsetPositionRanking::layerShift(this->_size);
+        for (unsigned int i = 0; i < this->_size * this->_size; i++) {
+            if ((ground >> i) & 1) {
+                occupied.set(groundShift + i);
+            }
+        }
+
+        unsigned int firstPieces = 0;
+        while (true) {
+            if (this->isValidColouring(pieces, firstPieces)) {
+                auto colourings = BitsetPositionRanking::binomial(pieces, firstPieces);
+                if (colouringRank < colourings) {
+                    break;
+                }
+                colouringRank -= colourings;
+            }
+            firstPieces++;
+        }
+        std::vector<unsigned int> pieceOffsets = {};
+        for (unsigned int offset = 0; offset < 140; offset++) {
+            if (occupied.test(offset)) {
+                pieceOffsets.emplace_back(offset);
+            }
+        }
+        auto first = std::bitset<140>(0);
+        auto pieceIndex = pieces;
+        for (auto chosen = firstPieces; chosen > 0; chosen--) {
+            do {
+                pieceIndex--;
+            } while (BitsetPositionRanking::binomial(pieceIndex, chosen) > colouringRank);
+            colouringRank -= BitsetPositionRanking::binomial(pieceIndex, chosen);
+            first.set(pieceOffsets[pieceIndex]);
+        }
+
+        return BitsetPosition(
+                BitsetBoard(this->_size, first),
+                BitsetBoard(this->_size, occupied ^ first),
+                BitsetBoard::neutralBoard(this->_size),
+                firstTurn
+        );
+    }
+
+    unsigned long long BitsetPositionRanking::canonicalRank(const BitsetPosition &position) const {
+        return this->rank(this->canonicalize(position));
+    }
+
+    BitsetPosition BitsetPositionRanking::canonicalize(const BitsetPosition &position) const {
+        auto canonical = position;
+        auto minimumRank = this->rank(position);
+        auto first = position.firstBoard();
+        auto second = position.secondBoard();
+        for (auto i = 0; i < 7; i++) {
+            if (i == 3) {
+                first = first.mirrorHorizontal();
+                second = second.mirrorHorizontal();
+            } else {
+                first = first.rotate90();
+                second = second.rotate90();
+            }
+            auto image = BitsetPosition(first, second, position.neutralBoard(), position.isFirstTurn());
+            auto imageRank = this->rank(image);
+            if (imageRank < minimumRank) {
+                minimumRank = imageRank;
+                canonical = image;
+            }
+        }
+        return canonical;
+    }
+
+    bool BitsetPositionRanking::isCanonical(const BitsetPosition &position) const {
+        return this->canonicalRank(position) == this->rank(position);
+    }
+
+    const std::vector<unsigned long long> &BitsetPositionRanking::completions(unsigned char layerSize,
+                                                                              unsigned long long forced) {
+        auto key = (forced << 3) | layerSize;
+        if (this->_completions.count(key)) {
+            return this->_completions[key];
+        }
+
+        std::vector<unsigned long long> completions = {};
+        if (layerSize == this->_size) {
+            auto neutral = this->groundNeutral();
+            auto fixedPieces = static_cast<unsigned int>(std::popcount(forced & ~neutral));
+            auto freeCells = layerSize * layerSize - static_cast<unsigned int>(std::popcount(forced | neutral));
+            completions.resize(fixedPieces + freeCells + 1, 0);
+            for (unsigned int i = 0; i <= freeCells; i++) {
+                completions[fixedPieces + i] = BitsetPositionRanking::binomial(freeCells, i);
+            }
+        } else {
+            auto free = ((1ULL << (layerSize * layerSize)) - 1) & ~forced;
+            auto sub = 0ULL;
+            do {
+                auto layer = forced | sub;
+                auto layerPieces = static_cast<unsigned int>(std::popcount(layer));
+                const auto &upper = this->completions(layerSize + 1, this->shadow(layerSize, layer));
+                if (completions.size() < upper.size() + layerPieces) {
+                    completions.resize(upper.size() + layerPieces, 0);
+                }
+                for (unsigned int i = 0; i < upper.size(); i++) {
+                    completions[layerPieces + i] += upper[i];
+                }
+                sub = ((sub | ~free) + 1) & free;
+            } while (sub != 0);
+        }
+        return this->_completions[key] = completions;
+    }
+
+    unsigned long long BitsetPositionRanking::completions(unsigned char layerSize, unsigned long long forced,
+                                                          unsigned int pieces) const {
+        const auto &completions = this->_completions.at((forced << 3) | layerSize);
+        return pieces < completions.size() ? completions[pieces] : 0;
+    }
+
+    unsigned long long BitsetPositionRanking::fixedConfigurations(unsigned int symmetry) const {
+        // A fixed configuration is a union of orbits, each of one colour, so only the number of occupied
+        // orbits of each length matters for the colourings.
+        std::unordered_map<unsigned long long, OrbitCounts> memo = {};
+        unsigned long long fixed = 0;
+        for (const auto &[key, occupancies]: this->fixedOccupancies(symmetry, 1, 0, memo)) {
+            unsigned int lengths[] = {key & 0xff, (key >> 8) & 0xff, key >> 16};
+            auto pieces = lengths[0] + 2 * lengths[1] + 4 * lengths[2];
+            unsigned long long colourings = 0;
+            for (unsigned int ones = 0; ones <= lengths[0]; ones++) {
+                for (unsigned int twos = 0; twos <= lengths[1]; twos++) {
+                    for (unsigned int fours = 0; fours <= lengths[2]; fours++) {
+                        if (this->isValidColouring(pieces, ones + 2 * twos + 4 * fours)) {
+                            colourings += BitsetPositionRanking::binomial(lengths[0], ones)
+                                          * BitsetPositionRanking::binomial(lengths[1], twos)
+                                          * BitsetPositionRanking::binomial(lengths[2], fours);
+                        }
+                    }
+                }
+            }
+            fixed += occupancies * colourings;
+        }
+        return fixed;
+    }
+
+    BitsetPositionRanking::OrbitCounts BitsetPositionRanking::fixedOccupancies(
+            unsigned int symmetry, unsigned char layerSize, unsigned long long forced,
+            std::unordered_map<unsigned long long, OrbitCounts> &memo) const {
+        auto key = (forced << 3) | layerSize;
+        if (memo.count(key)) {
+            return memo[key];
+        }
+
+        // The symmetry maps the forced cells, the neutral piece and every layer onto themselves, so the free
+        // cells are whole orbits and an invariant layer is the forced cells plus any set of them.
+        auto keyOf = [](unsigned long long orbit) {
+            auto length = std::popcount(orbit);
+            return length == 1 ? 1u : length == 2 ? 1u << 8 : 1u << 16;
+        };
+        // The neutral piece supports like a piece but is not one.
+        auto ground = layerSize == this->_size;
+        auto neutral = ground ? this->groundNeutral() : 0;
+        unsigned int fixedKey = 0;
+        std::vector<unsigned long long> freeOrbits = {};
+        for (auto orbit: this->orbits(symmetry, layerSize)) {
+            if ((orbit & (forced | neutral)) == 0) {
+                freeOrbits.emplace_back(orbit);
+            } else if ((orbit & forced & ~neutral) != 0) {
+                fixedKey += keyOf(orbit);
+            }
+        }
+
+        OrbitCounts counts = {};
+        for (unsigned long long chosen = 0; chosen < (1ULL << freeOrbits.size()); chosen++) {
+            auto layer = forced;
+            auto layerKey = fixedKey;
+            for (unsigned int i = 0; i < freeOrbits.size(); i++) {
+                if ((chosen >> i) & 1) {
+                    layer |= freeOrbits[i];
+                    layerKey += keyOf(freeOrbits[i]);
+                }
+            }
+            if (ground) {
+                counts[layerKey]++;
+                continue;
+            }
+            for (const auto &[upperKey, occupancies]: this->fixedOccupancies(
+                    symmetry, layerSize + 1, this->shadow(layerSize, layer), memo)) {
+                counts[layerKey + upperKey] += occupancies;
+            }
+        }
+        return memo[key] = counts;
+    }
+
+    std::vector<unsigned long long> BitsetPositionRanking::orbits(unsigned int symmetry,
+                                                                  unsigned char layerSize) const {
+        std::vector<unsigned long long> orbits = {};
+        unsigned long long seen = 0;
+        for (unsigned int cell = 0; cell < (unsigned int) layerSize * layerSize; cell++) {
+            if ((seen >> cell) & 1) {
+                continue;
+            }
+            unsigned long long orbit = 0;
+            auto next = cell;
+            do {
+                orbit |= 1ULL << next;
+                next = BitsetPositionRanking::symmetric(symmetry, next / layerSize, next % layerSize, layerSize - 1);
+            } while (next != cell);
+            seen |= orbit;
+            orbits.emplace_back(orbit);
+        }
+        return orbits;
+    }
+
+    unsigned long long BitsetPositionRanking::shadow(unsigned char layerSize, unsigned long long layer) const {
+        unsigned long long shadow = 0;
+        const auto rowMask = (1ULL << layerSize) - 1;
+        for (unsigned int row = 0; row < layerSize; row++) {
+            auto bits = (layer >> (row * layerSize)) & rowMask;
+            auto spread = bits | (bits << 1);
+            shadow |= spread << (row * (layerSize + 1));
+            shadow |= spread << ((row + 1) * (layerSize + 1));
+        }
+        return shadow;
+    }
+
+    unsigned long long BitsetPositionRanking::layer(const std::bitset<140> &bitset, unsigned char layerSize) const {
+        unsigned long long layer = 0;
+        auto shift = BitsetPositionRanking::layerShift(layerSize);
+        for (unsigned int i = 0; i < layerSize * layerSize; i++) {
+            if (bitset.test(shift + i)) {
+                layer |= 1ULL << i;
+            }
+        }
+        return layer;
+    }
+
+    unsigned long long BitsetPositionRanking::groundNeutral() const {
+        return this->_size % 2 == 1 ? 1ULL << this->_neutralOffset : 0;
+    }
+
+    bool BitsetPositionRanking::isValidColouring(unsigned int pieces, unsigned int firstPieces) const {
+        return firstPieces <= pieces
+               && firstPieces <= this->_piecesPerPlayer
+               && pieces - firstPieces <= this->_piecesPerPlayer;
+    }
+
+    unsigned int BitsetPositionRanking::layerShift(unsigned char layerSize) {
+        unsigned int layerShift = 0;
+        for (auto i = 0; i < layerSize; i++) {
+            layerShift += i * i;
+        }
+        return layerShift;
+    }
+
+    unsigned int BitsetPositionRanking::symmetric(unsigned int symmetry, unsigned int row, unsigned int column,
+                                                  unsigned int last) {
+        auto layerSize = last + 1;
+        switch (symmetry) {
+            case 1:
+                return column * layerSize + last - row;
+            case 2:
+                return (last - row) * layerSize + last - column;
+            case 3:
+                return (last - column) * layerSize + row;
+            case 4:
+                return row * layerSize + last - column;
+            case 5:
+                return (last - row) * layerSize + column;
+            case 6:
+                return column * layerSize + row;
+            case 7:
+                return (last - column) * layerSize + last - row;
+            default:
+                return row * layerSize + column;
+        }
+    }
+
+    unsigned long long BitsetPositionRanking::binomial(unsigned int n, unsigned int k) {
+        if (k > n) {
+            return 0;
+        }
+        unsigned long long result = 1;
+        for (unsigned int i = 0; i < k; i++) {
+            result = result * (n - i) / (i + 1);
+        }
+        return result;
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef MOSAICGAME_BITSETPOSITIONRANKING_H
+#define MOSAICGAME_BITSETPOSITIONRANKING_H
+
+#include <bitset>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include "BitsetPosition.h"
+
+namespace MosaicGame::Game {
+    // Bijection between [0, count()) and every placement configuration of a size: support-respecting
+    // occupancy of the pyramid with the neutral piece in place and at most piecesPerPlayer() pieces each.
+    // Configurations are ordered by piece count, then occupancy layer by layer from the top, then colouring.
+    class BitsetPositionRanking {
+    public:
+        explicit BitsetPositionRanking(unsigned char size);
+
+        [[nodiscard]] unsigned char size() const;
+
+        [[nodiscard]] unsigned long long count() const;
+
+        [[nodiscard]] unsigned long long rank(const BitsetPosition &position) const;
+
+        [[nodiscard]] BitsetPosition unrank(unsigned long long index, bool firstTurn) const;
+
+        // Configurations up to the eight board symmetries, counted with Burnside's lemma. BitsetPositionClassRanking
+        // numbers them densely.
+        [[nodiscard]] unsigned long long classCount() const;
+
+        // Smallest rank among the eight board symmetries of the position. This is not a dense class index:
+        // canonical ranks are spread over [0, count()), and only classCount() of them are taken.
+        // BitsetPositionClassRanking::rank() gives the dense one.
+        [[nodiscard]] unsigned long long canonicalRank(const BitsetPosition &position) const;
+
+        [[nodiscard]] BitsetPosition canonicalize(const BitsetPosition &position) const;
+
+        [[nodiscard]] bool isCanonical(const BitsetPosition &position) const;
+
+    private:
+        // Occupancy counts keyed by the number of occupied orbits of each length: 1 + (2 << 8) + (4 << 16).
+        using OrbitCounts = std::map<unsigned int, unsigned long long>;
+
+        const unsigned char _size;
+        unsigned short _piecesPerPlayer;
+        unsigned int _neutralOffset;
+        std::vector<unsigned long long> _countOffsets;
+        std::vector<unsigned long long> _colourings;
+        std::unordered_map<unsigned long long, std::vector<unsigned long long>> _completions;
+        unsigned long long _classCount;
+
+        [[nodiscard]] const std::vector<unsigned long long> &completions(unsigned char layerSize,
+                                                                         unsigned long long forced);
+
+        [[nodiscard]] unsigned long long completions(unsigned char layerSize, unsigned long long forced,
+                                                     unsigned int pieces) const;
+
+        // Configurations left unchanged by the symmetry, 0 being the identity and 1-7 as in symmetric().
+        [[nodiscard]] unsigned long long fixedConfigurations(unsigned int symmetry) const;
+
+        [[nodiscard]] OrbitCounts fixedOccupancies(unsigned int symmetry, unsigned char layerSize,
+                                                   unsigned long long forced,
+                                                   std::unordered_map<unsigned long long, OrbitCounts> &memo) const;
+
+        [[nodiscard]] std::vector<unsigned long long> orbits(unsigned int symmetry, unsigned char layerSize) const;
+
+        [[nodiscard]] unsigned long long shadow(unsigned char layerSize, unsigned long long layer) const;
+
+        [[nodiscard]] unsigned long long layer(const std::bitset<140> &bitset, unsigned char layerSize) const;
+
+        [[nodiscard]] unsigned long long groundNeutral() const;
+
+        [[nodiscard]] bool isValidColouring(unsigned int pieces, unsigned int firstPieces) const;
+
+        static unsigned int layerShift(unsigned char layerSize);
+
+        // The cell (row, column) of a layer whose last index is last, moved by the symmetry.
+        static unsigned int symmetric(unsigned int symmetry, unsigned int row, unsigned int column, unsigned int last);
+
+        static unsigned long long binomial(unsigned int n, unsigned int k);
+    };
+}
+
+#endif //MOSAICGAME_BITSETPOSITIONRANKING_H
@@ -88,7 +88,7 @@ namespace MosaicGame::Game {
     }
 
     bool GMPOneToOneGame::isLegalMove(const GMPMove &move) const {
-        return (this->legalBoard() & move.toBoard(this->_size)).count() > 0;
+        return this->legalBoard().test(move.toOffset());
     }
 
     GMPBoard GMPOneToOneGame::firstBoard() const {
@@ -104,19 +104,18 @@ namespace MosaicGame::Game {
     }
 
     GMPBoard GMPOneToOneGame::legalBoard() const {
-        return this->vacantBoard() & this->scaffoldedBoard();
-    }
-
-    GMPBoard GMPOneToOneGame::vacantBoard() const {
-        return this->occupiedBoard().flip();
-    }
-
-    GMPBoard GMPOneToOneGame::scaffoldedBoard() const {
-        return this->_groundBoard | this->occupiedBoard().promoteFour();
+        auto occupiedBoard = this->occupiedBoard();
+        auto legalBoard = occupiedBoard.promoteFour();
+        legalBoard |= this->_groundBoard;
+        legalBoard &= occupiedBoard.flip();
+        return legalBoard;
     }
 
     GMPBoard GMPOneToOneGame::occupiedBoard() const {
-        return this->_neutralBoard | this->_firstBoard | this->_secondBoard;
+        auto occupiedBoard = this->_neutralBoard;
+        occupiedBoard |= this->_firstBoard;
+        occupiedBoard |= this->_secondBoard;
+        return occupiedBoard;
     }
 
     GMPBoard GMPOneToOneGame::playerBoardAtMovesMade(unsigned short movesMade) const {
@@ -141,59 +140,48 @@ namespace MosaicGame::Game {
         return this->_undoCount > 0;
     }
 
-    void GMPOneToOneGame::makeMove(const GMPMove &move) {
+    GameStatus GMPOneToOneGame::tryMakeMove(const GMPMove &move) {
 
         if (this->isOver()) {
-            throw std::runtime_error("The game is already over.");
+            return GameStatus::GameOver;
         }
 
         if (!this->isLegalMove(move)) {
-            throw std::runtime_error("Making an illegal move is attempted.");
+            return GameStatus::IllegalMove;
         }
 
         this->handleMove(move, this->movesMade());
 
-        this->_moves = this->moves();
+        this->_moves.erase(this->_moves.end() - this->_undoCount, this->_moves.end());
         this->_moves.emplace_back(this->normalizeMove(move));
         this->_undoCount = 0;
+        return GameStatus::Ok;
+    }
+
+    void GMPOneToOneGame::makeMove(const GMPMove &move) {
+        switch (this->tryMakeMove(move)) {
+            case GameStatus::GameOver:
+                throw std::runtime_error("The game is already over.");
+            case GameStatus::IllegalMove:
+                throw std::runtime_error("Making an illegal move is attempted.");
+            default:
+                break;
+        }
     }
 
     void GMPOneToOneGame::handleMove(const GMPMove &move, unsigned int movesMade) {
 
         if (movesMade % 2 == 0) {
-            this->_firstBoard = this->_firstBoard | move.toBoard(this->_size);
+            this->_firstBoard |= move.toBoard(this->_size);
         } else {
-            this->_secondBoard = this->_secondBoard | move.toBoard(this->_size);
+            this->_secondBoard |= move.toBoard(this->_size);
         }
 
         GMPBoard occupiedBoard = this->occupiedBoard();
 
         do {
-            GMPBoard firstChainBoard = this->legalBoard() & this->_firstBoard.promoteMajority();
-            auto firstVacancy = this->_piecesPerPlayer - this->_firstBoard.count();
-            if (firstChainBoard.count() <= firstVacancy) {
-                this->_firstBoard = this->_firstBoard | firstChainBoard;
-            } else {
-                auto chainMoves = GMPMove::fromBoard(firstChainBoard);
-                for (auto i = 0; i < firstVacancy; i++) {
-                    GMPMove chainMove = chainMoves.front();
-                    chainMoves.erase(chainMoves.begin());
-                    this->_firstBoard = this->_firstBoard | chainMove.toBoard(this->_size);
-                }
-            }
-
-            GMPBoard secondChainBoard = this->legalBoard() & this->_secondBoard.promoteMajority();
-            auto secondVacancy = this->_piecesPerPlayer - this->_secondBoard.count();
-            if (secondChainBoard.count() <= secondVacancy) {
-                this->_secondBoard = this->_secondBoard | secondChainBoard;
-            } else {
-                auto chainMoves = GMPMove::fromBoard(secondChainBoard);
-                for (auto i = 0; i < secondVacancy; i++) {
-                    GMPMove chainMove = chainMoves.front();
-                    chainMoves.erase(chainMoves.begin());
-                    this->_secondBoard = this->_secondBoard | chainMove.toBoard(this->_size);
-                }
-            }
+            this->chain(this->_firstBoard);
+            this->chain(this->_secondBoard);
 
             GMPBoard newOccupiedBoard = this->occupiedBoard();
             if (occupiedBoard == newOccupiedBoard) {
@@ -205,33 +193,62 @@ namespace MosaicGame::Game {
         } while (!this->isOver());
     }
 
+    void GMPOneToOneGame::chain(GMPBoard &board) {
+        auto chainBoard = this->legalBoard();
+        chainBoard &= board.promoteMajority();
+        auto vacancy = this->_piecesPerPlayer - board.count();
+        if (chainBoard.count() <= vacancy) {
+            board |= chainBoard;
+        } else {
+            auto offset = chainBoard.scan(0);
+            for (unsigned int i = 0; i < vacancy; i++) {
+                board |= GMPBoard::cellBoard(this->_size, offset);
+                offset = chainBoard.scan(offset + 1);
+            }
+        }
+    }
+
     std::size_t GMPOneToOneGame::state() const {
         return std::hash<std::string>{}(this->_firstBoard.toString() + this->_secondBoard.toString());
     }
 
-    void GMPOneToOneGame::undo() {
+    GameStatus GMPOneToOneGame::tryUndo() {
         if (!this->isUndoable()) {
-            throw std::runtime_error("The game is not undoable.");
+            return GameStatus::NotUndoable;
         }
 
         this->_undoCount++;
         this->replay();
+        return GameStatus::Ok;
     }
 
-    void GMPOneToOneGame::redo() {
+    GameStatus GMPOneToOneGame::tryRedo() {
         if (!this->isRedoable()) {
-            throw std::runtime_error("The game is not redoable.");
+            return GameStatus::NotRedoable;
         }
 
         this->_undoCount--;
         this->replay();
+        return GameStatus::Ok;
+    }
+
+    void GMPOneToOneGame::undo() {
+        if (this->tryUndo() != GameStatus::Ok) {
+            throw std::runtime_error("The game is not undoable.");
+        }
+    }
+
+    void GMPOneToOneGame::redo() {
+        if (this->tryRedo() != GameStatus::Ok) {
+            throw std::runtime_error("The game is not redoable.");
+        }
     }
 
     void GMPOneToOneGame::replay() {
         this->resetBoards();
         auto movesMade = 0;
         for (const auto &move: this->moves()) {
-            this->handleMove(this->transformMove(move), movesMade);
+            this->handleMove(this->transformMove(move), movesMade++);
         }
     }
 
@@ -328,7 +345,8 @@ namespace MosaicGame::Game {
 
     void GMPOneToOneGame::mirrored() {
         this->_mirrored = !this->_mirrored;
-        this->_rotations = -this->_rotations;
+        // Kept in [0, 4): normalizeMove and transformMove only handle non-negative rotations.
+        this->_rotations = (4 - this->_rotations) % 4;
     }
 
     void GMPOneToOneGame::rotated(int rotations) {
@@ -351,11 +369,15 @@ namespace MosaicGame::Game {
         if (this->_mirrored) {
             board = board.mirrorHorizontal();
         }
-        return GMPMove::fromBoard(board).front();
+        return GMPMove(board.scan(0));
     }
 
     GMPMove GMPOneToOneGame::transformMove(const GMPMove &move) const {
+        // The inverse of normalizeMove: the orientation mirrors first and rotates second.
         auto board = move.toBoard(this->_size);
+        if (this->_mirrored) {
+            board = board.mirrorHorizontal();
+        }
         switch (this->_rotations % 4) {
             case 1:
                 board = board.rotate90();
@@ -367,9 +389,6 @@ namespace MosaicGame::Game {
                 board = board.rotate270();
                 break;
         }
-        if (this->_mirrored) {
-            board = board.mirrorHorizontal();
-        }
-        return GMPMove::fromBoard(board).front();
+        return GMPMove(board.scan(0));
     }
 }
\ No newline at end of file
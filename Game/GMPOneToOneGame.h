@@ -9,85 +9,95 @@ using MosaicGame::Board::GMPBoard;
 using MosaicGame::Game::Move::GMPMove;
 
 namespace MosaicGame::Game {
-    class GMPOneToOneGame : public OneToOneGame<GMPBoard, GMPMove> {
+    class GMPOneToOneGame {
     public:
+        using BoardType = GMPBoard;
+
+        using MoveType = GMPMove;
+
         explicit GMPOneToOneGame(unsigned char size, std::vector<GMPMove> moves, bool mirrored, short rotations);
 
         explicit GMPOneToOneGame(unsigned char size);
 
-        [[nodiscard]] unsigned char size() const override;
+        [[nodiscard]] unsigned char size() const;
+
+        [[nodiscard]] unsigned short piecesPerPlayer() const;
+
+        [[nodiscard]] unsigned short movesMade() const;
+
+        [[nodiscard]] std::vector<GMPMove> moves() const;
 
-        [[nodiscard]] unsigned short piecesPerPlayer() const override;
+        [[nodiscard]] std::vector<GMPMove> legalMoves() const;
 
-        [[nodiscard]] unsigned short movesMade() const override;
+        [[nodiscard]] bool isOver() const;
 
-        [[nodiscard]] std::vector<GMPMove> moves() const override;
+        [[nodiscard]] unsigned short firstScore() const;
 
-        [[nodiscard]] std::vector<GMPMove> legalMoves() const override;
+        [[nodiscard]] unsigned short secondScore() const;
 
-        [[nodiscard]] bool isOver() const override;
+        [[nodiscard]] unsigned short playerScore() const;
 
-        [[nodiscard]] unsigned short firstScore() const override;
+        [[nodiscard]] unsigned short opponentScore() const;
 
-        [[nodiscard]] unsigned short secondScore() const override;
+        [[nodiscard]] bool firstWins() const;
 
-        [[nodiscard]] unsigned short playerScore() const override;
+        [[nodiscard]] bool secondWins() const;
 
-        [[nodiscard]] unsigned short opponentScore() const override;
+        [[nodiscard]] bool playerWins() const;
 
-        [[nodiscard]] bool firstWins() const override;
+        [[nodiscard]] bool opponentWins() const;
 
-        [[nodiscard]] bool secondWins() const override;
+        [[nodiscard]] bool isFirstTurn() const;
 
-        [[nodiscard]] bool playerWins() const override;
+        [[nodiscard]] bool isSecondTurn() const;
 
-        [[nodiscard]] bool opponentWins() const override;
+        [[nodiscard]] bool isLegalMove(const GMPMove &move) const;
 
-        [[nodiscard]] bool isFirstTurn() const override;
+        [[nodiscard]] GMPBoard firstBoard() const;
 
-        [[nodiscard]] bool isSecondTurn() const override;
+        [[nodiscard]] GMPBoard secondBoard() const;
 
-        [[nodiscard]] bool isLegalMove(const GMPMove &move) const override;
+        [[nodiscard]] GMPBoard playerBoard() const;
 
-        [[nodiscard]] GMPBoard firstBoard() const override;
+        [[nodiscard]] GMPBoard opponentBoard() const;
 
-        [[nodiscard]] GMPBoard secondBoard() const override;
+        [[nodiscard]] GMPBoard neutralBoard() const;
 
-        [[nodiscard]] GMPBoard playerBoard() const override;
+        [[nodiscard]] GMPBoard legalBoard() const;
 
-        [[nodiscard]] GMPBoard opponentBoard() const override;
+        [[nodiscard]] bool isUndoable() const;
 
-        [[nodiscard]] GMPBoard neutralBoard() const override;
+        [[nodiscard]] bool isRedoable() const;
 
-        [[nodiscard]] GMPBoard legalBoard() const override;
+        [[nodiscard]] std::size_t state() const;
 
-        [[nodiscard]] bool isUndoable() const override;
+        GameStatus tryMakeMove(const GMPMove &move);
 
-        [[nodiscard]] bool isRedoable() const override;
+        GameStatus tryUndo();
 
-        [[nodiscard]] std::size_t state() const override;
+        GameStatus tryRedo();
 
-        void makeMove(const GMPMove &move) override;
+        void makeMove(const GMPMove &move);
 
-        void undo() override;
+        void undo();
 
-        void redo() override;
+        void redo();
 
-        void flipVertical() override;
+        void flipVertical();
 
-        void mirrorHorizontal() override;
+        void mirrorHorizontal();
 
-        void flipDiagonal() override;
+        void flipDiagonal();
 
-        void rotate90() override;
+        void rotate90();
 
-        void rotate180() override;
+        void rotate180();
 
-        void rotate270() override;
+        void rotate270();
 
-        void transform() override;
+        void transform();
 
-        void resetTransformation() override;
+        void resetTransformation();
 
     private:
         const unsigned char _size;
@@ -108,14 +118,13 @@ namespace MosaicGame::Game {
 
         void handleMove(const GMPMove &move, unsigned int movesMade);
 
-        [[nodiscard]] GMPBoard playerBoardAtMovesMade(unsigned short movesMade) const;
+        // Fills the legal cells under a majority of the board, lowest offsets first when it runs out of pieces.
+        void chain(GMPBoard &board);
 
-        [[nodiscard]] GMPBoard vacantBoard() const;
+        [[nodiscard]] GMPBoard playerBoardAtMovesMade(unsigned short movesMade) const;
 
         [[nodiscard]] GMPBoard occupiedBoard() const;
 
-        [[nodiscard]] GMPBoard scaffoldedBoard() const;
-
         [[nodiscard]] GMPMove normalizeMove(const GMPMove &move) const;
 
         [[nodiscard]] GMPMove transformMove(const GMPMove &move) const;
@@ -124,6 +133,8 @@ namespace MosaicGame::Game {
 
         void rotated(int rotations);
     };
+
+    static_assert(OneToOneGame<GMPOneToOneGame>);
 }
 
 #endif //MOSAICGAME_GMPONETOONEGAME_H
@@ -1,3 +1,4 @@
+#include <bit>
 #include <vector>
 #include "BitsetMove.h"
 
@@ -16,13 +17,29 @@ namespace MosaicGame::Game::Move {
     std::vector<BitsetMove> BitsetMove::fromBoard(const BitsetBoard &board) {
         std::vector<BitsetMove> moves = {};
         moves.reserve(board.count());
-        auto boardString = board.toString();
-        auto length = boardString.length();
-        for (auto i = 0; i < length; i++) {
-            if (boardString[length - i - 1] == '1') {
-                moves.emplace_back(BitsetMove(i));
+        auto words = board.words();
+        for (unsigned int word = 0; word < BitsetBoard::WordCount; word++) {
+            for (auto bits = words[word]; bits != 0; bits &= bits - 1) {
+                moves.emplace_back(BitsetMove(word * 64 + std::countr_zero(bits)));
             }
         }
         return moves;
     }
+
+    BitsetMove BitsetMove::nthFromBoard(const BitsetBoard &board, unsigned int index) {
+        auto words = board.words();
+        unsigned int word = 0;
+        for (; word + 1 < BitsetBoard::WordCount; word++) {
+            auto count = (unsigned int) std::popcount(words[word]);
+            if (index < count) {
+                break;
+            }
+            index -= count;
+        }
+        auto bits = words[word];
+        for (; index > 0; index--) {
+            bits &= bits - 1;
+        }
+        return BitsetMove(word * 64 + std::countr_zero(bits));
+    }
 }
@@ -8,19 +8,25 @@
 using MosaicGame::Board::BitsetBoard;
 
 namespace MosaicGame::Game::Move {
-    class BitsetMove : public Move<BitsetBoard> {
+    class BitsetMove {
     public:
         explicit BitsetMove(unsigned int offset);
 
-        [[nodiscard]] unsigned int toOffset() const override;
+        [[nodiscard]] unsigned int toOffset() const;
 
-        [[nodiscard]] BitsetBoard toBoard(unsigned int size) const override;
+        [[nodiscard]] BitsetBoard toBoard(unsigned int size) const;
 
         static std::vector<BitsetMove> fromBoard(const BitsetBoard& board);
 
+        // The index-th move of fromBoard(board) without building the list. The board must have more than
+        // index pieces.
+        static BitsetMove nthFromBoard(const BitsetBoard &board, unsigned int index);
+
     private:
         unsigned int _offset;
     };
+
+    static_assert(Move<BitsetMove, BitsetBoard>);
 }
 
 #endif //MOSAICGAME_BITSETMOVE_H
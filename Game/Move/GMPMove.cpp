@@ -10,18 +10,14 @@ namespace MosaicGame::Game::Move {
     }
 
     GMPBoard GMPMove::toBoard(unsigned int size) const {
-        return GMPBoard(size, std::string("1") + std::string(this->_offset, '0'));
+        return GMPBoard::cellBoard(size, this->_offset);
     }
 
     std::vector<GMPMove> GMPMove::fromBoard(const GMPBoard &board) {
         std::vector<GMPMove> moves = {};
         moves.reserve(board.count());
-        auto boardString = board.toString();
-        auto length = boardString.length();
-        for (auto i = 0; i < length; i++) {
-            if (boardString[length - i - 1] == '1') {
-                moves.emplace_back(GMPMove(i));
-            }
+        for (auto offset = board.scan(0); offset >= 0; offset = board.scan(offset + 1)) {
+            moves.emplace_back(GMPMove(offset));
         }
         return moves;
     }
@@ -8,19 +8,21 @@
 using MosaicGame::Board::GMPBoard;
 
 namespace MosaicGame::Game::Move {
-    class GMPMove : public Move<GMPBoard> {
+    class GMPMove {
     public:
         explicit GMPMove(unsigned int offset);
 
-        [[nodiscard]] unsigned int toOffset() const override;
+        [[nodiscard]] unsigned int toOffset() const;
 
-        [[nodiscard]] GMPBoard toBoard(unsigned int size) const override;
+        [[nodiscard]] GMPBoard toBoard(unsigned int size) const;
 
         static std::vector<GMPMove> fromBoard(const GMPBoard& board);
 
     private:
         unsigned int _offset;
     };
+
+    static_assert(Move<GMPMove, GMPBoard>);
 }
 
 #endif //MOSAICGAME_GMPMOVE_H
@@ -1,14 +1,16 @@
 #ifndef MOSAICGAME_MOVE_H
 #define MOSAICGAME_MOVE_H
 
-namespace MosaicGame::Game::Move {
-    template<class BOARD>
-    class Move {
-    public:
-        [[nodiscard]] virtual unsigned int toOffset() const = 0;
+#include <concepts>
 
-        [[nodiscard]] virtual BOARD toBoard(unsigned int size) const = 0;
-    };
+namespace MosaicGame::Game::Move {
+    // A move is the offset of the cell it fills, convertible to a single-piece board.
+    template<class T, class BOARD>
+    concept Move = std::copyable<T> && std::constructible_from<T, unsigned int> &&
+                   requires(const T move, unsigned int size) {
+                       { move.toOffset() } -> std::convertible_to<unsigned int>;
+                       { move.toBoard(size) } -> std::same_as<BOARD>;
+                   };
 }
 
 #endif //MOSAICGAME_MOVE_H
@@ -0,0 +1,47 @@
+#ifndef MOSAICGAME_WORDMOVE_H
+#define MOSAICGAME_WORDMOVE_H
+
+#include <vector>
+#include "Move.h"
+#include "../../Board/WordBoard.h"
+
+using MosaicGame::Board::WordBoard;
+
+namespace MosaicGame::Game::Move {
+    template<unsigned int WORDS>
+    class WordMove {
+    public:
+        explicit WordMove(unsigned int offset) : _offset(offset) {}
+
+        [[nodiscard]] unsigned int toOffset() const {
+            return this->_offset;
+        }
+
+        [[nodiscard]] WordBoard<WORDS> toBoard(unsigned int size) const {
+            return WordBoard<WORDS>::cellBoard(size, this->_offset);
+        }
+
+        static std::vector<WordMove> fromBoard(const WordBoard<WORDS> &board) {
+            std::vector<WordMove> moves = {};
+            auto count = board.count();
+            moves.reserve(count);
+            for (unsigned int i = 0; i < count; i++) {
+                moves.emplace_back(board.nthOffset(i));
+            }
+            return moves;
+        }
+
+        // The index-th move of fromBoard(board) without building the list. The board must have more than
+        // index pieces.
+        static WordMove nthFromBoard(const WordBoard<WORDS> &board, unsigned int index) {
+            return WordMove(board.nthOffset(index));
+        }
+
+    private:
+        unsigned int _offset;
+    };
+
+    static_assert(Move<WordMove<3>, WordBoard<3>>);
+}
+
+#endif //MOSAICGAME_WORDMOVE_H
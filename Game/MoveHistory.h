@@ -0,0 +1,91 @@
+#ifndef MOSAICGAME_MOVEHISTORY_H
+#define MOSAICGAME_MOVEHISTORY_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "NodeArena.h"
+
+namespace MosaicGame::Game {
+    // Persistent move stack. Copies and pushes share the existing nodes, so forking a history costs
+    // a reference count regardless of its length and every fork keeps the common prefix only once.
+    // Nodes come from a NodeArena rather than the general-purpose heap.
+    template<class MOVE>
+    class MoveHistory {
+    public:
+        MoveHistory() = default;
+
+        explicit MoveHistory(const std::vector<MOVE> &moves) {
+            for (const auto &move: moves) {
+                *this = this->push(move);
+            }
+        }
+
+        // Creates the calling thread's node cache now. Thread-local objects created afterwards are destroyed
+        // before it, so the histories they hold can still be freed at thread exit.
+        static void prepareThread(const MOVE &move) {
+            (void) MoveHistory().push(move);
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return this->_tail == nullptr ? 0 : this->_tail->size;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return this->_tail == nullptr;
+        }
+
+        [[nodiscard]] const MOVE &back() const {
+            return this->_tail->move;
+        }
+
+        [[nodiscard]] MoveHistory push(const MOVE &move) const {
+            auto node = Node{move, this->_tail, this->size() + 1};
+            return MoveHistory(std::allocate_shared<Node>(NodeAllocator<Node>(), std::move(node)));
+        }
+
+        [[nodiscard]] MoveHistory pop(std::size_t count = 1) const {
+            auto tail = this->_tail;
+            for (; count > 0 && tail != nullptr; count--) {
+                tail = tail->parent;
+            }
+            return MoveHistory(std::move(tail));
+        }
+
+        [[nodiscard]] std::vector<MOVE> toVector() const {
+            std::vector<MOVE> moves = {};
+            moves.reserve(this->size());
+            for (auto node = this->_tail.get(); node != nullptr; node = node->parent.get()) {
+                moves.emplace_back(node->move);
+            }
+            return std::vector<MOVE>(moves.rbegin(), moves.rend());
+        }
+
+        // Visits the moves oldest first without materialising them.
+        template<class FUNCTION>
+        void forEach(FUNCTION &&function) const {
+            forEach(this->_tail.get(), function);
+        }
+
+    private:
+        struct Node {
+            MOVE move;
+            std::shared_ptr<const Node> parent;
+            std::size_t size;
+        };
+
+        template<class FUNCTION>
+        static void forEach(const Node *node, FUNCTION &function) {
+            if (node != nullptr) {
+                forEach(node->parent.get(), function);
+                function(node->move);
+            }
+        }
+
+        std::shared_ptr<const Node> _tail;
+
+        explicit MoveHistory(std::shared_ptr<const Node> tail) : _tail(std::move(tail)) {}
+    };
+}
+
+#endif //MOSAICGAME_MOVEHISTORY_H
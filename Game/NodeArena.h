@@ -0,0 +1,125 @@
+#ifndef MOSAICGAME_NODEARENA_H
+#define MOSAICGAME_NODEARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace MosaicGame::Game {
+    // Fixed-size slot allocator. Each thread keeps its own free list carved from chunks that live for
+    // the whole process, so slots may be freed on any thread; a thread's leftovers are handed back to
+    // a shared list when it exits.
+    template<std::size_t SIZE, std::size_t ALIGNMENT>
+    class NodeArena {
+    public:
+        static void *allocate() {
+            auto &cache = NodeArena::cache();
+            if (cache.free == nullptr) {
+                cache.free = NodeArena::refill();
+            }
+            auto slot = cache.free;
+            cache.free = slot->next;
+            return slot;
+        }
+
+        static void deallocate(void *pointer) {
+            auto &cache = NodeArena::cache();
+            auto slot = (Slot *) pointer;
+            slot->next = cache.free;
+            cache.free = slot;
+        }
+
+    private:
+        static constexpr std::size_t SlotsPerChunk = 256;
+
+        union Slot {
+            Slot *next;
+            alignas(ALIGNMENT) unsigned char storage[SIZE];
+        };
+
+        struct Shared {
+            std::mutex mutex;
+            Slot *free = nullptr;
+        };
+
+        struct Cache {
+            Slot *free = nullptr;
+
+            ~Cache() {
+                if (this->free == nullptr) {
+                    return;
+                }
+                auto tail = this->free;
+                while (tail->next != nullptr) {
+                    tail = tail->next;
+                }
+                auto &shared = NodeArena::shared();
+                std::lock_guard<std::mutex> lock(shared.mutex);
+                tail->next = shared.free;
+                shared.free = this->free;
+                this->free = nullptr;
+            }
+        };
+
+        static Shared &shared() {
+            static auto *shared = new Shared();
+            return *shared;
+        }
+
+        static Cache &cache() {
+            thread_local Cache cache;
+            return cache;
+        }
+
+        static Slot *refill() {
+            auto &shared = NodeArena::shared();
+            {
+                std::lock_guard<std::mutex> lock(shared.mutex);
+                if (shared.free != nullptr) {
+                    auto free = shared.free;
+                    shared.free = nullptr;
+                    return free;
+                }
+            }
+            auto chunk = new Slot[SlotsPerChunk];
+            for (std::size_t i = 0; i + 1 < SlotsPerChunk; i++) {
+                chunk[i].next = &chunk[i + 1];
+            }
+            chunk[SlotsPerChunk - 1].next = nullptr;
+            return chunk;
+        }
+    };
+
+    template<class T>
+    class NodeAllocator {
+    public:
+        using value_type = T;
+
+        NodeAllocator() = default;
+
+        template<class U>
+        explicit NodeAllocator(const NodeAllocator<U> &) {}
+
+        [[nodiscard]] T *allocate(std::size_t count) {
+            if (count != 1) {
+                return std::allocator<T>().allocate(count);
+            }
+            return (T *) NodeArena<sizeof(T), alignof(T)>::allocate();
+        }
+
+        void deallocate(T *pointer, std::size_t count) {
+            if (count != 1) {
+                std::allocator<T>().deallocate(pointer, count);
+                return;
+            }
+            NodeArena<sizeof(T), alignof(T)>::deallocate(pointer);
+        }
+
+        template<class U>
+        bool operator==(const NodeAllocator<U> &) const {
+            return true;
+        }
+    };
+}
+
+#endif //MOSAICGAME_NODEARENA_H
@@ -1,85 +1,67 @@
 #ifndef MOSAICGAME_ONETOONEGAME_H
 #define MOSAICGAME_ONETOONEGAME_H
 
+#include <concepts>
+#include <cstddef>
 #include <vector>
+#include "Move/Move.h"
+#include "../Board/Board.h"
 
 namespace MosaicGame::Game {
-    template<class BOARD, class MOVE>
-    class OneToOneGame {
-    public:
-        [[nodiscard]] virtual unsigned char size() const = 0;
-
-        [[nodiscard]] virtual unsigned short piecesPerPlayer() const = 0;
-
-        [[nodiscard]] virtual unsigned short movesMade() const = 0;
-
-        [[nodiscard]] virtual std::vector<MOVE> moves() const = 0;
-
-        [[nodiscard]] virtual std::vector<MOVE> legalMoves() const = 0;
-
-        [[nodiscard]] virtual bool isOver() const = 0;
-
-        [[nodiscard]] virtual unsigned short firstScore() const = 0;
-
-        [[nodiscard]] virtual unsigned short secondScore() const = 0;
-
-        [[nodiscard]] virtual unsigned short playerScore() const = 0;
-
-        [[nodiscard]] virtual unsigned short opponentScore() const = 0;
-
-        [[nodiscard]] virtual bool firstWins() const = 0;
-
-        [[nodiscard]] virtual bool secondWins() const = 0;
-
-        [[nodiscard]] virtual bool playerWins() const = 0;
-
-        [[nodiscard]] virtual bool opponentWins() const = 0;
-
-        [[nodiscard]] virtual bool isFirstTurn() const = 0;
-
-        [[nodiscard]] virtual bool isSecondTurn() const = 0;
-
-        [[nodiscard]] virtual bool isLegalMove(const MOVE &move) const = 0;
-
-        [[nodiscard]] virtual BOARD firstBoard() const = 0;
-
-        [[nodiscard]] virtual BOARD secondBoard() const = 0;
-
-        [[nodiscard]] virtual BOARD neutralBoard() const = 0;
-
-        [[nodiscard]] virtual BOARD legalBoard() const = 0;
-
-        [[nodiscard]] virtual BOARD playerBoard() const = 0;
-
-        [[nodiscard]] virtual BOARD opponentBoard() const = 0;
-
-        [[nodiscard]] virtual bool isUndoable() const = 0;
-
-        [[nodiscard]] virtual bool isRedoable() const = 0;
-
-        [[nodiscard]] virtual std::size_t state() const = 0;
-
-        virtual void makeMove(const MOVE &move) = 0;
-
-        virtual void undo() = 0;
-
-        virtual void redo() = 0;
-
-        virtual void flipVertical() = 0;
-
-        virtual void mirrorHorizontal() = 0;
-
-        virtual void flipDiagonal() = 0;
-
-        virtual void rotate90() = 0;
-
-        virtual void rotate180() = 0;
-
-        virtual void rotate270() = 0;
-
-        virtual void transform() = 0;
+    enum class GameStatus : unsigned char {
+        Ok = 0,
+        GameOver = 1,
+        IllegalMove = 2,
+        NotUndoable = 3,
+        NotRedoable = 4,
+    };
 
-        virtual void resetTransformation() = 0;
+    // A two-player game with history and orientation. Implementations name their board and move types
+    // as BoardType and MoveType; code that must pick a game at run time uses AnyOneToOneGame instead.
+    template<class GAME>
+    concept OneToOneGame = Board::Board<typename GAME::BoardType> &&
+                           Move::Move<typename GAME::MoveType, typename GAME::BoardType> &&
+                           requires(GAME game, const GAME constGame, const typename GAME::MoveType move) {
+        { constGame.size() } -> std::convertible_to<unsigned char>;
+        { constGame.piecesPerPlayer() } -> std::convertible_to<unsigned short>;
+        { constGame.movesMade() } -> std::convertible_to<unsigned short>;
+        { constGame.moves() } -> std::same_as<std::vector<typename GAME::MoveType>>;
+        { constGame.legalMoves() } -> std::same_as<std::vector<typename GAME::MoveType>>;
+        { constGame.isOver() } -> std::same_as<bool>;
+        { constGame.firstScore() } -> std::convertible_to<unsigned short>;
+        { constGame.secondScore() } -> std::convertible_to<unsigned short>;
+        { constGame.playerScore() } -> std::convertible_to<unsigned short>;
+        { constGame.opponentScore() } -> std::convertible_to<unsigned short>;
+        { constGame.firstWins() } -> std::same_as<bool>;
+        { constGame.secondWins() } -> std::same_as<bool>;
+        { constGame.playerWins() } -> std::same_as<bool>;
+        { constGame.opponentWins() } -> std::same_as<bool>;
+        { constGame.isFirstTurn() } -> std::same_as<bool>;
+        { constGame.isSecondTurn() } -> std::same_as<bool>;
+        { constGame.isLegalMove(move) } -> std::same_as<bool>;
+        { constGame.firstBoard() } -> std::same_as<typename GAME::BoardType>;
+        { constGame.secondBoard() } -> std::same_as<typename GAME::BoardType>;
+        { constGame.neutralBoard() } -> std::same_as<typename GAME::BoardType>;
+        { constGame.legalBoard() } -> std::same_as<typename GAME::BoardType>;
+        { constGame.playerBoard() } -> std::same_as<typename GAME::BoardType>;
+        { constGame.opponentBoard() } -> std::same_as<typename GAME::BoardType>;
+        { constGame.isUndoable() } -> std::same_as<bool>;
+        { constGame.isRedoable() } -> std::same_as<bool>;
+        { constGame.state() } -> std::same_as<std::size_t>;
+        { game.tryMakeMove(move) } -> std::same_as<GameStatus>;
+        { game.tryUndo() } -> std::same_as<GameStatus>;
+        { game.tryRedo() } -> std::same_as<GameStatus>;
+        game.makeMove(move);
+        game.undo();
+        game.redo();
+        game.flipVertical();
+        game.mirrorHorizontal();
+        game.flipDiagonal();
+        game.rotate90();
+        game.rotate180();
+        game.rotate270();
+        game.transform();
+        game.resetTransformation();
     };
 }
 
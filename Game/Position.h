@@ -0,0 +1,28 @@
+#ifndef MOSAICGAME_POSITION_H
+#define MOSAICGAME_POSITION_H
+
+#include <concepts>
+#include <vector>
+#include "Move/Move.h"
+#include "../Board/Board.h"
+
+namespace MosaicGame::Game {
+    // The pieces on the board and the side to move, without history. Engines are templated on it, so their
+    // playouts inline the board operations of whichever backend they search.
+    template<class POSITION>
+    concept Position = std::copyable<POSITION> && Board::Board<typename POSITION::BoardType> &&
+                       Move::Move<typename POSITION::MoveType, typename POSITION::BoardType> &&
+                       requires(const POSITION position, const typename POSITION::MoveType move,
+                                const typename POSITION::BoardType board, unsigned int index) {
+        { position.size() } -> std::convertible_to<unsigned char>;
+        { position.isFirstTurn() } -> std::same_as<bool>;
+        { position.isOver() } -> std::same_as<bool>;
+        { position.firstWins() } -> std::same_as<bool>;
+        { position.legalBoard() } -> std::same_as<typename POSITION::BoardType>;
+        { position.successor(move) } -> std::same_as<POSITION>;
+        { POSITION::MoveType::fromBoard(board) } -> std::same_as<std::vector<typename POSITION::MoveType>>;
+        { POSITION::MoveType::nthFromBoard(board, index) } -> std::same_as<typename POSITION::MoveType>;
+    };
+}
+
+#endif //MOSAICGAME_POSITION_H
@@ -0,0 +1,353 @@
+#ifndef MOSAICGAME_WORDONETOONEGAME_H
+#define MOSAICGAME_WORDONETOONEGAME_H
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "OneToOneGame.h"
+#include "WordPosition.h"
+#include "Move/WordMove.h"
+#include "../Board/WordBoard.h"
+
+namespace MosaicGame::Game {
+    // A game over WordBoard<WORDS>, for the sizes beyond BitsetBoard::MaxSize that its words hold. Moves are
+    // resolved by WordPosition; like GMPOneToOneGame, the boards are kept in the shown orientation and the
+    // history in the orientation the game started in.
+    template<unsigned int WORDS>
+    class WordOneToOneGame {
+    public:
+        using BoardType = WordBoard<WORDS>;
+
+        using MoveType = Move::WordMove<WORDS>;
+
+        explicit WordOneToOneGame(unsigned char size, std::vector<MoveType> moves, bool mirrored, short rotations) :
+                _size(size),
+                _position(size),
+                _moves(std::move(moves)),
+                _undoCount(0),
+                _mirrored(mirrored),
+                _rotations((rotations % 4 + 4) % 4) {
+            if (size < 1) {
+                throw std::runtime_error("The size is not supported.");
+            }
+            this->replay();
+        }
+
+        explicit WordOneToOneGame(unsigned char size) :
+                WordOneToOneGame(size, std::vector<MoveType>{}, false, 0) {}
+
+        [[nodiscard]] unsigned char size() const {
+            return this->_size;
+        }
+
+        [[nodiscard]] unsigned short piecesPerPlayer() const {
+            return this->_position.piecesPerPlayer();
+        }
+
+        [[nodiscard]] unsigned short movesMade() const {
+            return this->_moves.size() - this->_undoCount;
+        }
+
+        [[nodiscard]] std::vector<MoveType> moves() const {
+            return std::vector<MoveType>(this->_moves.begin(), this->_moves.end() - this->_undoCount);
+        }
+
+        [[nodiscard]] std::vector<MoveType> legalMoves() const {
+            return MoveType::fromBoard(this->legalBoard());
+        }
+
+        [[nodiscard]] bool isOver() const {
+            return this->_position.isOver();
+        }
+
+        [[nodiscard]] unsigned short firstScore() const {
+            return this->firstBoard().count();
+        }
+
+        [[nodiscard]] unsigned short secondScore() const {
+            return this->secondBoard().count();
+        }
+
+        [[nodiscard]] unsigned short playerScore() const {
+            return this->playerBoard().count();
+        }
+
+        [[nodiscard]] unsigned short opponentScore() const {
+            return this->opponentBoard().count();
+        }
+
+        [[nodiscard]] bool firstWins() const {
+            return this->_position.firstWins();
+        }
+
+        [[nodiscard]] bool secondWins() const {
+            return this->_position.secondWins();
+        }
+
+        [[nodiscard]] bool playerWins() const {
+            return this->isFirstTurn() ? this->firstWins() : this->secondWins();
+        }
+
+        [[nodiscard]] bool opponentWins() const {
+            return this->isFirstTurn() ? this->secondWins() : this->firstWins();
+        }
+
+        [[nodiscard]] bool isFirstTurn() const {
+            return this->movesMade() % 2 == 0;
+        }
+
+        [[nodiscard]] bool isSecondTurn() const {
+            return !this->isFirstTurn();
+        }
+
+        [[nodiscard]] bool isLegalMove(const MoveType &move) const {
+            return this->_position.isLegalMove(move.toOffset());
+        }
+
+        [[nodiscard]] BoardType firstBoard() const {
+            return this->_position.firstBoard();
+        }
+
+        [[nodiscard]] BoardType secondBoard() const {
+            return this->_position.secondBoard();
+        }
+
+        [[nodiscard]] BoardType playerBoard() const {
+            return this->isFirstTurn() ? this->firstBoard() : this->secondBoard();
+        }
+
+        [[nodiscard]] BoardType opponentBoard() const {
+            return this->isFirstTurn() ? this->secondBoard() : this->firstBoard();
+        }
+
+        [[nodiscard]] BoardType neutralBoard() const {
+            return this->_position.neutralBoard();
+        }
+
+        [[nodiscard]] BoardType legalBoard() const {
+            return this->_position.legalBoard();
+        }
+
+        [[nodiscard]] bool isUndoable() const {
+            return this->_undoCount < this->_moves.size();
+        }
+
+        [[nodiscard]] bool isRedoable() const {
+            return this->_undoCount > 0;
+        }
+
+        [[nodiscard]] std::size_t state() const {
+            return std::hash<std::string>{}(this->firstBoard().toString() + this->secondBoard().toString());
+        }
+
+        GameStatus tryMakeMove(const MoveType &move) {
+            if (this->isOver()) {
+                return GameStatus::GameOver;
+            }
+            if (!this->isLegalMove(move)) {
+                return GameStatus::IllegalMove;
+            }
+            this->_position = this->_position.successor(move);
+            this->_moves.erase(this->_moves.end() - this->_undoCount, this->_moves.end());
+            this->_moves.emplace_back(this->normalizeMove(move));
+            this->_undoCount = 0;
+            return GameStatus::Ok;
+        }
+
+        GameStatus tryUndo() {
+            if (!this->isUndoable()) {
+                return GameStatus::NotUndoable;
+            }
+            this->_undoCount++;
+            this->replay();
+            return GameStatus::Ok;
+        }
+
+        GameStatus tryRedo() {
+            if (!this->isRedoable()) {
+                return GameStatus::NotRedoable;
+            }
+            this->_undoCount--;
+            this->replay();
+            return GameStatus::Ok;
+        }
+
+        void makeMove(const MoveType &move) {
+            switch (this->tryMakeMove(move)) {
+                case GameStatus::GameOver:
+                    throw std::runtime_error("The game is already over.");
+                case GameStatus::IllegalMove:
+                    throw std::runtime_error("Making an illegal move is attempted.");
+                default:
+                    break;
+            }
+        }
+
+        void undo() {
+            if (this->tryUndo() != GameStatus::Ok) {
+                throw std::runtime_error("The game is not undoable.");
+            }
+        }
+
+        void redo() {
+            if (this->tryRedo() != GameStatus::Ok) {
+                throw std::runtime_error("The game is not redoable.");
+            }
+        }
+
+        void flipVertical() {
+            this->mirrored();
+            this->rotated(2);
+            this->transformBoards(&BoardType::flipVertical);
+        }
+
+        void mirrorHorizontal() {
+            this->mirrored();
+            this->transformBoards(&BoardType::mirrorHorizontal);
+        }
+
+        void flipDiagonal() {
+            this->mirrored();
+            this->rotated(1);
+            this->transformBoards(&BoardType::flipDiagonal);
+        }
+
+        void rotate90() {
+            this->rotated(1);
+            this->transformBoards(&BoardType::rotate90);
+        }
+
+        void rotate180() {
+            this->rotated(2);
+            this->transformBoards(&BoardType::rotate180);
+        }
+
+        void rotate270() {
+            this->rotated(3);
+            this->transformBoards(&BoardType::rotate270);
+        }
+
+        void transform() {
+            auto minimumState = this->state();
+            auto mirrored = this->_mirrored;
+            auto rotations = this->_rotations;
+            auto minimumPosition = this->_position;
+            for (auto i = 0; i < 7; i++) {
+                if (i == 3) {
+                    this->mirrorHorizontal();
+                } else {
+                    this->rotate90();
+                }
+                auto newState = this->state();
+                if (newState < minimumState) {
+                    minimumState = newState;
+                    mirrored = this->_mirrored;
+                    rotations = this->_rotations;
+                    minimumPosition = this->_position;
+                }
+            }
+            this->_mirrored = mirrored;
+            this->_rotations = rotations;
+            this->_position = minimumPosition;
+        }
+
+        void resetTransformation() {
+            switch (this->_rotations) {
+                case 1:
+                    this->rotate270();
+                    break;
+                case 2:
+                    this->rotate180();
+                    break;
+                case 3:
+                    this->rotate90();
+                    break;
+            }
+            if (this->_mirrored) {
+                this->mirrorHorizontal();
+            }
+        }
+
+    private:
+        using Position = WordPosition<WORDS>;
+
+        unsigned char _size;
+        Position _position;
+        std::vector<MoveType> _moves;
+        unsigned int _undoCount;
+        bool _mirrored;
+        int _rotations;
+
+        void replay() {
+            this->_position = Position(this->_size);
+            for (const auto &move: this->moves()) {
+                this->_position = this->_position.successor(this->transformMove(move));
+            }
+        }
+
+        // The neutral board is symmetric, so only the players' boards move.
+        void transformBoards(BoardType (BoardType::*transform)() const) {
+            this->_position = Position(
+                    (this->_position.firstBoard().*transform)(),
+                    (this->_position.secondBoard().*transform)(),
+                    this->_position.neutralBoard(),
+                    this->_position.isFirstTurn()
+            );
+        }
+
+        void mirrored() {
+            this->_mirrored = !this->_mirrored;
+            this->_rotations = (4 - this->_rotations) % 4;
+        }
+
+        void rotated(int rotations) {
+            this->_rotations = (this->_rotations + rotations) % 4;
+        }
+
+        [[nodiscard]] MoveType normalizeMove(const MoveType &move) const {
+            auto board = move.toBoard(this->_size);
+            switch (this->_rotations) {
+                case 1:
+                    board = board.rotate270();
+                    break;
+                case 2:
+                    board = board.rotate180();
+                    break;
+                case 3:
+                    board = board.rotate90();
+                    break;
+            }
+            if (this->_mirrored) {
+                board = board.mirrorHorizontal();
+            }
+            return MoveType(board.nthOffset(0));
+        }
+
+        // The inverse of normalizeMove: the orientation mirrors first and rotates second.
+        [[nodiscard]] MoveType transformMove(const MoveType &move) const {
+            auto board = move.toBoard(this->_size);
+            if (this->_mirrored) {
+                board = board.mirrorHorizontal();
+            }
+            switch (this->_rotations) {
+                case 1:
+                    board = board.rotate90();
+                    break;
+                case 2:
+                    board = board.rotate180();
+                    break;
+                case 3:
+                    board = board.rotate270();
+                    break;
+            }
+            return MoveType(board.nthOffset(0));
+        }
+    };
+
+    static_assert(OneToOneGame<WordOneToOneGame<3>>);
+}
+
+#endif //MOSAICGAME_WORDONETOONEGAME_H
@@ -0,0 +1,164 @@
+#ifndef MOSAICGAME_WORDPOSITION_H
+#define MOSAICGAME_WORDPOSITION_H
+
+#include "Position.h"
+#include "Move/WordMove.h"
+#include "../Board/WordBoard.h"
+
+using MosaicGame::Board::WordBoard;
+
+namespace MosaicGame::Game {
+    // The rules of BitsetPosition over a WordBoard, for sizes beyond BitsetBoard::MaxSize. Moves are cell
+    // offsets.
+    template<unsigned int WORDS>
+    class WordPosition {
+    public:
+        using BoardType = WordBoard<WORDS>;
+
+        using MoveType = Move::WordMove<WORDS>;
+
+        explicit WordPosition(const BoardType &firstBoard, const BoardType &secondBoard,
+                              const BoardType &neutralBoard, bool firstTurn) :
+                _firstBoard(firstBoard),
+                _secondBoard(secondBoard),
+                _neutralBoard(neutralBoard),
+                _groundBoard(BoardType::groundBoard(firstBoard.size())),
+                _piecesPerPlayer(BoardType::emptyBoard(firstBoard.size()).flip().count() / 2),
+                _firstTurn(firstTurn) {}
+
+        explicit WordPosition(unsigned char size) :
+                WordPosition(
+                        BoardType::emptyBoard(size),
+                        BoardType::emptyBoard(size),
+                        BoardType::neutralBoard(size),
+                        true
+                ) {}
+
+        [[nodiscard]] unsigned char size() const {
+            return this->_firstBoard.size();
+        }
+
+        [[nodiscard]] unsigned short piecesPerPlayer() const {
+            return this->_piecesPerPlayer;
+        }
+
+        [[nodiscard]] bool isFirstTurn() const {
+            return this->_firstTurn;
+        }
+
+        [[nodiscard]] bool isSecondTurn() const {
+            return !this->_firstTurn;
+        }
+
+        [[nodiscard]] bool isOver() const {
+            return this->firstWins() || this->secondWins();
+        }
+
+        [[nodiscard]] bool firstWins() const {
+            return this->_piecesPerPlayer <= this->_firstBoard.count();
+        }
+
+        [[nodiscard]] bool secondWins() const {
+            return this->_piecesPerPlayer <= this->_secondBoard.count();
+        }
+
+        [[nodiscard]] bool isLegalMove(unsigned int offset) const {
+            return this->legalBoard().test(offset);
+        }
+
+        [[nodiscard]] BoardType firstBoard() const {
+            return this->_firstBoard;
+        }
+
+        [[nodiscard]] BoardType secondBoard() const {
+            return this->_secondBoard;
+        }
+
+        [[nodiscard]] BoardType neutralBoard() const {
+            return this->_neutralBoard;
+        }
+
+        [[nodiscard]] BoardType legalBoard() const {
+            auto occupiedBoard = this->occupiedBoard();
+            return occupiedBoard.flip() & (this->_groundBoard | occupiedBoard.promoteFour());
+        }
+
+        [[nodiscard]] BoardType occupiedBoard() const {
+            return this->_neutralBoard | this->_firstBoard | this->_secondBoard;
+        }
+
+        [[nodiscard]] bool operator==(const WordPosition &other) const {
+            return this->_firstTurn == other._firstTurn
+                   && this->_firstBoard == other._firstBoard
+                   && this->_secondBoard == other._secondBoard
+                   && this->_neutralBoard == other._neutralBoard;
+        }
+
+        // Places a piece at the offset for the side to move and resolves chains. Legality is not checked.
+        [[nodiscard]] WordPosition successor(unsigned int offset) const {
+            auto position = *this;
+            position.handleMove(offset);
+            position._firstTurn = !this->_firstTurn;
+            return position;
+        }
+
+        [[nodiscard]] WordPosition successor(const MoveType &move) const {
+            return this->successor(move.toOffset());
+        }
+
+    private:
+        BoardType _firstBoard;
+        BoardType _secondBoard;
+        BoardType _neutralBoard;
+        BoardType _groundBoard;
+        unsigned short _piecesPerPlayer;
+        bool _firstTurn;
+
+        void handleMove(unsigned int offset) {
+            auto &moverBoard = this->_firstTurn ? this->_firstBoard : this->_secondBoard;
+            moverBoard = moverBoard | BoardType::cellBoard(this->size(), offset);
+
+            auto legalBoard = this->legalBoard();
+            auto firstMajorityBoard = this->_firstBoard.promoteMajority();
+            auto secondMajorityBoard = this->_secondBoard.promoteMajority();
+
+            do {
+                auto chained = false;
+                if (this->chain(this->_firstBoard, legalBoard & firstMajorityBoard)) {
+                    chained = true;
+                    legalBoard = this->legalBoard();
+                    firstMajorityBoard = this->_firstBoard.promoteMajority();
+                }
+                if (this->chain(this->_secondBoard, legalBoard & secondMajorityBoard)) {
+                    chained = true;
+                    legalBoard = this->legalBoard();
+                    secondMajorityBoard = this->_secondBoard.promoteMajority();
+                }
+                if (!chained) {
+                    break;
+                }
+            } while (!this->isOver());
+        }
+
+        // Fills the chain cells for one side, lowest offsets first when it runs out of pieces.
+        bool chain(BoardType &board, const BoardType &chainBoard) const {
+            auto chainCount = chainBoard.count();
+            if (chainCount == 0) {
+                return false;
+            }
+            auto vacancy = this->_piecesPerPlayer - board.count();
+            if (chainCount <= vacancy) {
+                board = board | chainBoard;
+            } else {
+                for (unsigned int i = 0; i < vacancy; i++) {
+                    board = board | BoardType::cellBoard(this->size(), chainBoard.nthOffset(i));
+                }
+            }
+            return true;
+        }
+    };
+
+    static_assert(Position<WordPosition<3>>);
+}
+
+#endif //MOSAICGAME_WORDPOSITION_H
@@ -0,0 +1,48 @@
+#include <cstdlib>
+#include <new>
+#include "Instrumentation.h"
+
+// Replaces the global allocation functions to count heap allocations. Only linked into the shared
+// library of instrumented builds, so it counts every allocation in the host process.
+
+using MosaicGame::Instrumentation::Counter;
+using MosaicGame::Instrumentation::Instrumentation;
+
+void *operator new(std::size_t size) {
+    Instrumentation::add(Counter::Allocations, 1);
+    Instrumentation::add(Counter::AllocatedBytes, size);
+    if (auto pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    Instrumentation::add(Counter::Allocations, 1);
+    Instrumentation::add(Counter::AllocatedBytes, size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept {
+    return ::operator new(size, tag);
+}
+
+void operator delete(void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
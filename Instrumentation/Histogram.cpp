@@ -0,0 +1,75 @@
+#include "Histogram.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace MosaicGame::Instrumentation {
+
+    void Histogram::record(std::uint64_t value) {
+        this->_buckets[Histogram::bucket(value)].fetch_add(1, std::memory_order_relaxed);
+        this->_count.fetch_add(1, std::memory_order_relaxed);
+        this->_sum.fetch_add(value, std::memory_order_relaxed);
+        auto maximum = this->_maximum.load(std::memory_order_relaxed);
+        while (value > maximum && !this->_maximum.compare_exchange_weak(maximum, value, std::memory_order_relaxed)) {}
+    }
+
+    void Histogram::reset() {
+        for (auto &bucket: this->_buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        this->_count.store(0, std::memory_order_relaxed);
+        this->_sum.store(0, std::memory_order_relaxed);
+        this->_maximum.store(0, std::memory_order_relaxed);
+    }
+
+    std::uint64_t Histogram::count() const {
+        return this->_count.load(std::memory_order_relaxed);
+    }
+
+    double Histogram::mean() const {
+        auto count = this->count();
+        return count == 0 ? 0.0 : (double) this->_sum.load(std::memory_order_relaxed) / count;
+    }
+
+    std::uint64_t Histogram::maximum() const {
+        return this->_maximum.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t Histogram::percentile(double quantile) const {
+        std::uint64_t total = 0;
+        for (const auto &bucket: this->_buckets) {
+            total += bucket.load(std::memory_order_relaxed);
+        }
+        if (total == 0) {
+            return 0;
+        }
+        auto rank = std::max<std::uint64_t>(1, (std::uint64_t) (quantile * total + 0.5));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < Histogram::Buckets; i++) {
+            seen += this->_buckets[i].load(std::memory_order_relaxed);
+            if (seen >= rank) {
+                return Histogram::bucketValue(i);
+            }
+        }
+        return Histogram::bucketValue(Histogram::Buckets - 1);
+    }
+
+    std::size_t Histogram::bucket(std::uint64_t value) {
+        if (value < Histogram::SubBuckets) {
+            return value;
+        }
+        auto highest = (unsigned int) std::bit_width(value) - 1;
+        if (highest >= Histogram::MaximumBits) {
+            return Histogram::Buckets - 1;
+        }
+        return (highest - 3) * Histogram::SubBuckets + ((value >> (highest - 4)) & (Histogram::SubBuckets - 1));
+    }
+
+    std::uint64_t Histogram::bucketValue(std::size_t bucket) {
+        if (bucket < Histogram::SubBuckets) {
+            return bucket;
+        }
+        auto highest = bucket / Histogram::SubBuckets + 3;
+        return (Histogram::SubBuckets + bucket % Histogram::SubBuckets) << (highest - 4);
+    }
+}
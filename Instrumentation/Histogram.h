@@ -0,0 +1,45 @@
+#ifndef MOSAICGAME_HISTOGRAM_H
+#define MOSAICGAME_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace MosaicGame::Instrumentation {
+    // Lock-free log-linear histogram in the style of HdrHistogram: values below 16 are exact and every
+    // power-of-two range above is split into 16 buckets, bounding the relative error to about 6%.
+    class Histogram {
+    public:
+        static constexpr unsigned int SubBuckets = 16;
+        static constexpr unsigned int MaximumBits = 44;
+        static constexpr std::size_t Buckets = (MaximumBits - 3) * SubBuckets;
+
+        constexpr Histogram() : _buckets(), _count(0), _sum(0), _maximum(0) {}
+
+        void record(std::uint64_t value);
+
+        void reset();
+
+        [[nodiscard]] std::uint64_t count() const;
+
+        [[nodiscard]] double mean() const;
+
+        [[nodiscard]] std::uint64_t maximum() const;
+
+        // Lower bound of the bucket holding the given quantile (0 to 1).
+        [[nodiscard]] std::uint64_t percentile(double quantile) const;
+
+        [[nodiscard]] static std::size_t bucket(std::uint64_t value);
+
+        [[nodiscard]] static std::uint64_t bucketValue(std::size_t bucket);
+
+    private:
+        std::array<std::atomic<std::uint64_t>, Buckets> _buckets;
+        std::atomic<std::uint64_t> _count;
+        std::atomic<std::uint64_t> _sum;
+        std::atomic<std::uint64_t> _maximum;
+    };
+}
+
+#endif //MOSAICGAME_HISTOGRAM_H
@@ -0,0 +1,110 @@
+#include "Instrumentation.h"
+
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+namespace MosaicGame::Instrumentation {
+
+    namespace {
+        struct NamedHistogram {
+            const char *name = nullptr;
+            const char *unit = nullptr;
+            Histogram histogram;
+        };
+
+        struct Registry {
+            std::array<std::atomic<std::uint64_t>, (std::size_t) Counter::Count> counters = {};
+            std::mutex mutex;
+            std::atomic<std::size_t> histogramCount = 0;
+            std::array<NamedHistogram, Instrumentation::MaximumHistograms> histograms;
+        };
+
+        // Constant-initialised so the allocation hooks can count before any dynamic initialisation.
+        constinit Registry globalRegistry;
+
+        Registry &registry() {
+            return globalRegistry;
+        }
+
+        const char *counterNames[] = {
+                "promoteCalls",
+                "promoteNanoseconds",
+                "chainIterations",
+                "chainedMoves",
+                "chainedPieces",
+                "legalBoards",
+                "replays",
+                "allocations",
+                "allocatedBytes",
+        };
+    }
+
+    bool Instrumentation::enabled() {
+#ifdef MOSAICGAME_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void Instrumentation::add(Counter counter, std::uint64_t amount) {
+        registry().counters[(std::size_t) counter].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    std::uint64_t Instrumentation::value(Counter counter) {
+        return registry().counters[(std::size_t) counter].load(std::memory_order_relaxed);
+    }
+
+    Histogram &Instrumentation::histogram(const char *name, const char *unit) {
+        auto &registry = MosaicGame::Instrumentation::registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto count = registry.histogramCount.load(std::memory_order_relaxed);
+        if (count == Instrumentation::MaximumHistograms) {
+            throw std::runtime_error("Too many histograms are registered.");
+        }
+        registry.histograms[count].name = name;
+        registry.histograms[count].unit = unit;
+        registry.histogramCount.store(count + 1, std::memory_order_release);
+        return registry.histograms[count].histogram;
+    }
+
+    std::string Instrumentation::snapshot() {
+        auto &registry = MosaicGame::Instrumentation::registry();
+        std::ostringstream json;
+        json << std::fixed << std::setprecision(1);
+        json << "{\"enabled\": " << (Instrumentation::enabled() ? "true" : "false") << ", \"counters\": {";
+        for (std::size_t i = 0; i < (std::size_t) Counter::Count; i++) {
+            json << (i == 0 ? "" : ", ") << '"' << counterNames[i] << "\": "
+                 << registry.counters[i].load(std::memory_order_relaxed);
+        }
+        json << "}, \"histograms\": {";
+        auto count = registry.histogramCount.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < count; i++) {
+            const auto &named = registry.histograms[i];
+            const auto &histogram = named.histogram;
+            json << (i == 0 ? "" : ", ") << '"' << named.name << "\": {\"unit\": \"" << named.unit << '"'
+                 << ", \"count\": " << histogram.count()
+                 << ", \"mean\": " << histogram.mean()
+                 << ", \"p50\": " << histogram.percentile(0.5)
+                 << ", \"p90\": " << histogram.percentile(0.9)
+                 << ", \"p99\": " << histogram.percentile(0.99)
+                 << ", \"p999\": " << histogram.percentile(0.999)
+                 << ", \"max\": " << histogram.maximum() << '}';
+        }
+        json << "}}";
+        return json.str();
+    }
+
+    void Instrumentation::reset() {
+        auto &registry = MosaicGame::Instrumentation::registry();
+        for (auto &counter: registry.counters) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+        auto count = registry.histogramCount.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < count; i++) {
+            registry.histograms[i].histogram.reset();
+        }
+    }
+}
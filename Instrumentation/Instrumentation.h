@@ -0,0 +1,98 @@
+#ifndef MOSAICGAME_INSTRUMENTATION_H
+#define MOSAICGAME_INSTRUMENTATION_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "Histogram.h"
+
+namespace MosaicGame::Instrumentation {
+    enum class Counter : unsigned int {
+        PromoteCalls,
+        PromoteNanoseconds,
+        ChainIterations,
+        ChainedMoves,
+        ChainedPieces,
+        LegalBoards,
+        Replays,
+        Allocations,
+        AllocatedBytes,
+        Count,
+    };
+
+    // Process-wide counters and named histograms. Only builds configured with
+    // MOSAICGAME_INSTRUMENTATION record anything; the macros below compile to nothing otherwise.
+    class Instrumentation {
+    public:
+        static constexpr std::size_t MaximumHistograms = 128;
+
+        [[nodiscard]] static bool enabled();
+
+        static void add(Counter counter, std::uint64_t amount);
+
+        [[nodiscard]] static std::uint64_t value(Counter counter);
+
+        // Registers the histogram on first use; name and unit must outlive the process.
+        [[nodiscard]] static Histogram &histogram(const char *name, const char *unit);
+
+        // JSON object with every counter and every histogram's count, mean, percentiles and maximum.
+        [[nodiscard]] static std::string snapshot();
+
+        static void reset();
+    };
+
+    class ScopedCounterTimer {
+    public:
+        explicit ScopedCounterTimer(Counter counter) :
+                _counter(counter),
+                _start(std::chrono::steady_clock::now()) {}
+
+        ~ScopedCounterTimer() {
+            auto elapsed = std::chrono::steady_clock::now() - this->_start;
+            Instrumentation::add(this->_counter, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+    private:
+        Counter _counter;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    class ScopedLatency {
+    public:
+        explicit ScopedLatency(Histogram &histogram) :
+                _histogram(histogram),
+                _start(std::chrono::steady_clock::now()) {}
+
+        ~ScopedLatency() {
+            auto elapsed = std::chrono::steady_clock::now() - this->_start;
+            this->_histogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+    private:
+        Histogram &_histogram;
+        std::chrono::steady_clock::time_point _start;
+    };
+}
+
+#ifdef MOSAICGAME_INSTRUMENTATION
+#define MOSAICGAME_COUNT(counter, amount) \
+    ::MosaicGame::Instrumentation::Instrumentation::add(::MosaicGame::Instrumentation::Counter::counter, (amount))
+#define MOSAICGAME_TIME(counter) \
+    ::MosaicGame::Instrumentation::ScopedCounterTimer mosaicgameTimer(::MosaicGame::Instrumentation::Counter::counter)
+#define MOSAICGAME_RECORD(name, unit, value) do { \
+        static auto &mosaicgameHistogram = ::MosaicGame::Instrumentation::Instrumentation::histogram(name, unit); \
+        mosaicgameHistogram.record(value); \
+    } while (false)
+#define MOSAICGAME_LATENCY() \
+    static auto &mosaicgameLatencyHistogram = ::MosaicGame::Instrumentation::Instrumentation::histogram(__func__, "ns"); \
+    ::MosaicGame::Instrumentation::ScopedLatency mosaicgameLatency(mosaicgameLatencyHistogram)
+#else
+#define MOSAICGAME_COUNT(counter, amount) ((void) 0)
+#define MOSAICGAME_TIME(counter) ((void) 0)
+#define MOSAICGAME_RECORD(name, unit, value) ((void) 0)
+#define MOSAICGAME_LATENCY() ((void) 0)
+#endif
+
+#endif //MOSAICGAME_INSTRUMENTATION_H
@@ -0,0 +1,148 @@
+#include "Tracer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace MosaicGame::Instrumentation {
+
+    namespace {
+        struct ThreadBuffer {
+            unsigned int thread;
+            std::unique_ptr<TraceEvent[]> events;
+            std::atomic<std::uint64_t> written;
+        };
+
+        struct Registry {
+            std::atomic<bool> enabled = false;
+            std::mutex mutex;
+            // Buffers outlive their threads so a trace can still be exported after workers exit.
+            std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+            // Buffers of exited threads, handed to the next threads that record.
+            std::vector<ThreadBuffer *> released;
+        };
+
+        Registry &registry() {
+            static auto *registry = new Registry();
+            return *registry;
+        }
+
+        // Returns its buffer to the registry when the thread exits.
+        struct ThreadSlot {
+            ThreadBuffer *buffer;
+
+            ThreadSlot() {
+                auto &registry = MosaicGame::Instrumentation::registry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                if (!registry.released.empty()) {
+                    this->buffer = registry.released.back();
+                    registry.released.pop_back();
+                    return;
+                }
+                auto buffer = std::make_unique<ThreadBuffer>();
+                buffer->thread = registry.buffers.size() + 1;
+                buffer->events = std::make_unique<TraceEvent[]>(Tracer::EventsPerThread);
+                buffer->written = 0;
+                this->buffer = buffer.get();
+                registry.buffers.emplace_back(std::move(buffer));
+            }
+
+            ThreadSlot(const ThreadSlot &) = delete;
+
+            ThreadSlot &operator=(const ThreadSlot &) = delete;
+
+            ~ThreadSlot() {
+                auto &registry = MosaicGame::Instrumentation::registry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                registry.released.emplace_back(this->buffer);
+            }
+        };
+
+        ThreadBuffer &threadBuffer() {
+            thread_local ThreadSlot slot;
+            return *slot.buffer;
+        }
+    }
+
+    void Tracer::start() {
+        registry().enabled.store(true, std::memory_order_relaxed);
+    }
+
+    void Tracer::stop() {
+        registry().enabled.store(false, std::memory_order_relaxed);
+    }
+
+    bool Tracer::enabled() {
+        return registry().enabled.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t Tracer::now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void Tracer::record(const char *name, const char *category, std::uint64_t start, std::uint64_t end) {
+        auto &buffer = threadBuffer();
+        auto written = buffer.written.load(std::memory_order_relaxed);
+        buffer.events[written % Tracer::EventsPerThread] = {name, category, start, end - start};
+        buffer.written.store(written + 1, std::memory_order_release);
+    }
+
+    std::string Tracer::chromeJson() {
+        auto &registry = MosaicGame::Instrumentation::registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        auto origin = std::numeric_limits<std::uint64_t>::max();
+        for (const auto &buffer: registry.buffers) {
+            auto written = buffer->written.load(std::memory_order_acquire);
+            for (auto i = written - std::min<std::uint64_t>(written, Tracer::EventsPerThread); i < written; i++) {
+                origin = std::min(origin, buffer->events[i % Tracer::EventsPerThread].start);
+            }
+        }
+
+        std::ostringstream json;
+        json << std::fixed << std::setprecision(3);
+        json << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+        auto first = true;
+        for (const auto &buffer: registry.buffers) {
+            json << (first ? "" : ",") << "\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": "
+                 << buffer->thread << ", \"args\": {\"name\": \"thread " << buffer->thread << "\"}}";
+            first = false;
+            auto written = buffer->written.load(std::memory_order_acquire);
+            for (auto i = written - std::min<std::uint64_t>(written, Tracer::EventsPerThread); i < written; i++) {
+                const auto &event = buffer->events[i % Tracer::EventsPerThread];
+                json << ",\n{\"name\": \"" << event.name << "\", \"cat\": \"" << event.category
+                     << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << buffer->thread
+                     << ", \"ts\": " << (event.start - origin) / 1000.0
+                     << ", \"dur\": " << event.duration / 1000.0 << '}';
+            }
+        }
+        json << "\n]}\n";
+        return json.str();
+    }
+
+    void Tracer::write(const std::string &path) {
+        std::ofstream stream(path);
+        stream << Tracer::chromeJson();
+        if (!stream) {
+            throw std::runtime_error("The trace could not be written.");
+        }
+    }
+
+    void Tracer::clear() {
+        auto &registry = MosaicGame::Instrumentation::registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (const auto &buffer: registry.buffers) {
+            buffer->written.store(0, std::memory_order_relaxed);
+        }
+    }
+}
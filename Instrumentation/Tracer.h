@@ -0,0 +1,71 @@
+#ifndef MOSAICGAME_TRACER_H
+#define MOSAICGAME_TRACER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace MosaicGame::Instrumentation {
+    struct TraceEvent {
+        const char *name;
+        const char *category;
+        std::uint64_t start;
+        std::uint64_t duration;
+    };
+
+    // Span recorder with one fixed-size ring buffer per thread; the newest events overwrite the oldest.
+    // A thread that exits hands its buffer, events and thread id included, to the next thread that records,
+    // so there are only as many buffers as threads alive at once. Recording costs a relaxed load while
+    // tracing is stopped. Names and categories must be string literals. Export after stop() for a consistent
+    // trace.
+    class Tracer {
+    public:
+        static constexpr std::size_t EventsPerThread = 1 << 16;
+
+        static void start();
+
+        static void stop();
+
+        [[nodiscard]] static bool enabled();
+
+        // Nanoseconds on the steady clock.
+        [[nodiscard]] static std::uint64_t now();
+
+        static void record(const char *name, const char *category, std::uint64_t start, std::uint64_t end);
+
+        // Chrome trace-event JSON, loadable in chrome://tracing or Perfetto.
+        [[nodiscard]] static std::string chromeJson();
+
+        static void write(const std::string &path);
+
+        static void clear();
+    };
+
+    class TraceSpan {
+    public:
+        TraceSpan(const char *name, const char *category) :
+                _name(name),
+                _category(category),
+                _start(Tracer::enabled() ? Tracer::now() : 0) {}
+
+        TraceSpan(const TraceSpan &) = delete;
+
+        TraceSpan &operator=(const TraceSpan &) = delete;
+
+        ~TraceSpan() {
+            if (this->_start != 0 && Tracer::enabled()) {
+                Tracer::record(this->_name, this->_category, this->_start, Tracer::now());
+            }
+        }
+
+    private:
+        const char *_name;
+        const char *_category;
+        std::uint64_t _start;
+    };
+}
+
+#define MOSAICGAME_TRACE_SPAN(name, category) \
+    ::MosaicGame::Instrumentation::TraceSpan mosaicgameTraceSpan(name, category)
+
+#endif //MOSAICGAME_TRACER_H
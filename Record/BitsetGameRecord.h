@@ -0,0 +1,86 @@
+#ifndef MOSAICGAME_BITSETGAMERECORD_H
+#define MOSAICGAME_BITSETGAMERECORD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MosaicGame::Record {
+    struct BitsetGameRecord {
+        enum Result : unsigned char {
+            None = 0,
+            FirstWins = 1,
+            SecondWins = 2,
+            Unfinished = 3,
+        };
+
+        unsigned char size = 7;
+        std::vector<unsigned char> moves;
+        // None is not stored.
+        Result result = None;
+        // Empty metadata is not stored.
+        std::string metadata;
+    };
+
+    // File layout, integers little-endian:
+    //   header   "MGRECORD", uint32 version, uint32 gamesPerBlock
+    //   blocks   uint32 storedLength, uint32 rawLength, uint32 games, uint8 codec, 3 padding bytes,
+    //            then storedLength bytes of the (possibly compressed) block
+    //   index    per block: uint64 file offset, uint64 index of its first game
+    //   footer   uint64 index offset, uint64 blocks, uint64 games, "MGRINDEX"
+    // A raw block holds its games back to back as uint8 size, uint8 flags (1: result, 2: metadata),
+    // [uint8 result], varint move count, one byte per move, [varint metadata length, metadata].
+    struct BitsetGameRecordFormat {
+        enum Codec : unsigned char {
+            Stored = 0,
+            Zlib = 1,
+        };
+
+        enum Flags : unsigned char {
+            HasResult = 1,
+            HasMetadata = 2,
+        };
+
+        static constexpr char Magic[8] = {'M', 'G', 'R', 'E', 'C', 'O', 'R', 'D'};
+
+        static constexpr char IndexMagic[8] = {'M', 'G', 'R', 'I', 'N', 'D', 'E', 'X'};
+
+        static constexpr std::uint32_t Version = 1;
+
+        static constexpr std::size_t HeaderLength = 16;
+
+        static constexpr std::size_t BlockHeaderLength = 16;
+
+        static constexpr std::size_t IndexEntryLength = 16;
+
+        static constexpr std::size_t FooterLength = 32;
+
+        static void appendFixed(std::vector<unsigned char> &buffer, std::uint64_t value, unsigned int bytes) {
+            for (unsigned int i = 0; i < bytes; i++) {
+                buffer.push_back((unsigned char) (value >> (i * 8)));
+            }
+        }
+
+        static void appendVarint(std::vector<unsigned char> &buffer, std::uint64_t value) {
+            while (value >= 0x80) {
+                buffer.push_back((unsigned char) (value | 0x80));
+                value >>= 7;
+            }
+            buffer.push_back((unsigned char) value);
+        }
+
+        static std::uint64_t readFixed(const unsigned char *data, unsigned int bytes) {
+            std::uint64_t value = 0;
+            for (unsigned int i = 0; i < bytes; i++) {
+                value |= (std::uint64_t) data[i] << (i * 8);
+            }
+            return value;
+        }
+
+        // Advances position past the varint; throws if it runs past length.
+        static std::uint64_t readVarint(const unsigned char *data, std::size_t length, std::size_t &position);
+    };
+}
+
+#endif //MOSAICGAME_BITSETGAMERECORD_H
@@ -0,0 +1,208 @@
+#include "BitsetGameRecordReader.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef MOSAICGAME_WITH_ZLIB
+
+#include <zlib.h>
+
+#endif
+
+namespace MosaicGame::Record {
+
+    std::uint64_t BitsetGameRecordFormat::readVarint(const unsigned char *data, std::size_t length,
+                                                     std::size_t &position) {
+        std::uint64_t value = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7) {
+            if (position >= length) {
+                break;
+            }
+            auto byte = data[position++];
+            value |= (std::uint64_t) (byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        throw std::runtime_error("The game record contains a malformed varint.");
+    }
+
+    BitsetGameRecordReader::BitsetGameRecordReader(const std::string &path) :
+            _mapping(nullptr),
+            _length(0),
+            _data(nullptr),
+            _indexOffset(0),
+            _blocks(0),
+            _games(0) {
+        auto descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            throw std::runtime_error("The game record file could not be opened.");
+        }
+        struct stat status{};
+        if (fstat(descriptor, &status) != 0
+            || status.st_size < (off_t) (BitsetGameRecordFormat::HeaderLength + BitsetGameRecordFormat::FooterLength)) {
+            close(descriptor);
+            throw std::runtime_error("The game record file is truncated.");
+        }
+        this->_length = status.st_size;
+        this->_mapping = mmap(nullptr, this->_length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        close(descriptor);
+        if (this->_mapping == MAP_FAILED) {
+            throw std::runtime_error("The game record file could not be mapped.");
+        }
+        this->_data = (const unsigned char *) this->_mapping;
+
+        auto footer = this->_data + this->_length - BitsetGameRecordFormat::FooterLength;
+        this->_indexOffset = BitsetGameRecordFormat::readFixed(footer, 8);
+        this->_blocks = BitsetGameRecordFormat::readFixed(footer + 8, 8);
+        this->_games = BitsetGameRecordFormat::readFixed(footer + 16, 8);
+        if (std::memcmp(this->_data, BitsetGameRecordFormat::Magic, 8) != 0
+            || BitsetGameRecordFormat::readFixed(this->_data + 8, 4) != BitsetGameRecordFormat::Version
+            || std::memcmp(footer + 24, BitsetGameRecordFormat::IndexMagic, 8) != 0
+            || this->_indexOffset + this->_blocks * BitsetGameRecordFormat::IndexEntryLength
+               != this->_length - BitsetGameRecordFormat::FooterLength) {
+            munmap(this->_mapping, this->_length);
+            throw std::runtime_error("The game record file is malformed or was not closed.");
+        }
+    }
+
+    BitsetGameRecordReader::~BitsetGameRecordReader() {
+        munmap(this->_mapping, this->_length);
+    }
+
+    std::uint64_t BitsetGameRecordReader::games() const {
+        return this->_games;
+    }
+
+    std::uint64_t BitsetGameRecordReader::blocks() const {
+        return this->_blocks;
+    }
+
+    BitsetGameRecord BitsetGameRecordReader::read(std::uint64_t game) const {
+        if (game >= this->_games) {
+            throw std::runtime_error("The game index is out of range.");
+        }
+        std::uint64_t low = 0;
+        std::uint64_t high = this->_blocks;
+        while (high - low > 1) {
+            auto middle = (low + high) / 2;
+            if (this->indexEntry(middle, 1) <= game) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+
+        BitsetGameRecord result = {};
+        this->readBlock(low, [game, &result](std::uint64_t index, const BitsetGameRecord &record) {
+            if (index == game) {
+                result = record;
+            }
+        });
+        return result;
+    }
+
+    void BitsetGameRecordReader::readBlock(
+            std::uint64_t block,
+            const std::function<void(std::uint64_t, const BitsetGameRecord &)> &callback
+    ) const {
+        auto raw = this->decodeBlock(block);
+        auto blockHeader = this->_data + this->indexEntry(block, 0);
+        auto games = BitsetGameRecordFormat::readFixed(blockHeader + 8, 4);
+        auto index = this->indexEntry(block, 1);
+
+        std::size_t position = 0;
+        BitsetGameRecord record = {};
+        for (std::uint64_t i = 0; i < games; i++) {
+            if (position + 2 > raw.size()) {
+                throw std::runtime_error("The game record block is truncated.");
+            }
+            record.size = raw[position++];
+            auto flags = raw[position++];
+            record.result = BitsetGameRecord::None;
+            if (flags & BitsetGameRecordFormat::HasResult) {
+                if (position >= raw.size()) {
+                    throw std::runtime_error("The game record block is truncated.");
+                }
+                record.result = (BitsetGameRecord::Result) raw[position++];
+            }
+            auto moves = BitsetGameRecordFormat::readVarint(raw.data(), raw.size(), position);
+            if (moves > raw.size() - position) {
+                throw std::runtime_error("The game record block is truncated.");
+            }
+            record.moves.assign(raw.begin() + (std::ptrdiff_t) position, raw.begin() + (std::ptrdiff_t) (position + moves));
+            position += moves;
+            record.metadata.clear();
+            if (flags & BitsetGameRecordFormat::HasMetadata) {
+                auto length = BitsetGameRecordFormat::readVarint(raw.data(), raw.size(), position);
+                if (length > raw.size() - position) {
+                    throw std::runtime_error("The game record block is truncated.");
+                }
+                record.metadata.assign((const char *) raw.data() + position, length);
+                position += length;
+            }
+            callback(index + i, record);
+        }
+    }
+
+    void BitsetGameRecordReader::forEach(
+            const std::function<void(std::uint64_t, const BitsetGameRecord &)> &callback
+    ) const {
+        for (std::uint64_t block = 0; block < this->_blocks; block++) {
+            this->readBlock(block, callback);
+        }
+    }
+
+    BitsetPosition BitsetGameRecordReader::replay(const BitsetGameRecord &record, bool trusted) {
+        auto position = BitsetPosition(record.size);
+        for (auto offset : record.moves) {
+            auto move = BitsetMove(offset);
+            if (!trusted && (position.isOver() || !position.isLegalMove(move))) {
+                throw std::runtime_error("The game record contains an illegal move.");
+            }
+            position = position.successor(move);
+        }
+        return position;
+    }
+
+    std::uint64_t BitsetGameRecordReader::indexEntry(std::uint64_t block, unsigned int field) const {
+        return BitsetGameRecordFormat::readFixed(
+                this->_data + this->_indexOffset + block * BitsetGameRecordFormat::IndexEntryLength + field * 8,
+                8
+        );
+    }
+
+    std::vector<unsigned char> BitsetGameRecordReader::decodeBlock(std::uint64_t block) const {
+        auto offset = this->indexEntry(block, 0);
+        if (offset + BitsetGameRecordFormat::BlockHeaderLength > this->_indexOffset) {
+            throw std::runtime_error("The game record index is corrupt.");
+        }
+        auto header = this->_data + offset;
+        auto storedLength = BitsetGameRecordFormat::readFixed(header, 4);
+        [[maybe_unused]] auto rawLength = BitsetGameRecordFormat::readFixed(header + 4, 4);
+        auto codec = header[12];
+        auto stored = header + BitsetGameRecordFormat::BlockHeaderLength;
+        if (offset + BitsetGameRecordFormat::BlockHeaderLength + storedLength > this->_indexOffset) {
+            throw std::runtime_error("The game record block is truncated.");
+        }
+
+        if (codec == BitsetGameRecordFormat::Stored) {
+            return std::vector<unsigned char>(stored, stored + storedLength);
+        }
+#ifdef MOSAICGAME_WITH_ZLIB
+        if (codec == BitsetGameRecordFormat::Zlib) {
+            std::vector<unsigned char> raw(rawLength);
+            uLongf length = rawLength;
+            if (uncompress(raw.data(), &length, stored, storedLength) != Z_OK || length != rawLength) {
+                throw std::runtime_error("The game record block could not be decompressed.");
+            }
+            return raw;
+        }
+#endif
+        throw std::runtime_error("The game record block uses an unsupported codec.");
+    }
+}
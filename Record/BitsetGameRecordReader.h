@@ -0,0 +1,57 @@
+#ifndef MOSAICGAME_BITSETGAMERECORDREADER_H
+#define MOSAICGAME_BITSETGAMERECORDREADER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "BitsetGameRecord.h"
+#include "../Game/BitsetPosition.h"
+
+using MosaicGame::Game::BitsetPosition;
+
+namespace MosaicGame::Record {
+    // Memory-maps a record file. Reads are const and keep no shared state, so one reader can serve
+    // several threads.
+    class BitsetGameRecordReader {
+    public:
+        explicit BitsetGameRecordReader(const std::string &path);
+
+        BitsetGameRecordReader(const BitsetGameRecordReader &) = delete;
+
+        BitsetGameRecordReader &operator=(const BitsetGameRecordReader &) = delete;
+
+        ~BitsetGameRecordReader();
+
+        [[nodiscard]] std::uint64_t games() const;
+
+        [[nodiscard]] std::uint64_t blocks() const;
+
+        [[nodiscard]] BitsetGameRecord read(std::uint64_t game) const;
+
+        // Decodes the games of one block in order; index is the game's position in the file.
+        void readBlock(std::uint64_t block,
+                       const std::function<void(std::uint64_t index, const BitsetGameRecord &record)> &callback) const;
+
+        void forEach(const std::function<void(std::uint64_t index, const BitsetGameRecord &record)> &callback) const;
+
+        // Final position of a game. Trusted replay skips every legality check and is meant for files
+        // this library wrote; untrusted replay throws on the first illegal move.
+        [[nodiscard]] static BitsetPosition replay(const BitsetGameRecord &record, bool trusted);
+
+    private:
+        void *_mapping;
+        std::size_t _length;
+        const unsigned char *_data;
+        std::uint64_t _indexOffset;
+        std::uint64_t _blocks;
+        std::uint64_t _games;
+
+        [[nodiscard]] std::uint64_t indexEntry(std::uint64_t block, unsigned int field) const;
+
+        [[nodiscard]] std::vector<unsigned char> decodeBlock(std::uint64_t block) const;
+    };
+}
+
+#endif //MOSAICGAME_BITSETGAMERECORDREADER_H
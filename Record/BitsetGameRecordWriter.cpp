@@ -0,0 +1,146 @@
+#include "BitsetGameRecordWriter.h"
+
+#include <stdexcept>
+#include "../Instrumentation/Tracer.h"
+
+#ifdef MOSAICGAME_WITH_ZLIB
+
+#include <zlib.h>
+
+#endif
+
+namespace MosaicGame::Record {
+
+    BitsetGameRecordWriter::BitsetGameRecordWriter(const std::string &path, std::uint32_t gamesPerBlock,
+                                                   bool compressed) :
+            _stream(path, std::ios::binary | std::ios::trunc),
+            _gamesPerBlock(gamesPerBlock == 0 ? 1 : gamesPerBlock),
+            _compressed(compressed),
+            _offset(0),
+            _games(0),
+            _blockGames(0),
+            _block{},
+            _index{} {
+        if (!this->_stream) {
+            throw std::runtime_error("The game record file could not be opened.");
+        }
+        std::vector<unsigned char> header(BitsetGameRecordFormat::Magic, BitsetGameRecordFormat::Magic + 8);
+        BitsetGameRecordFormat::appendFixed(header, BitsetGameRecordFormat::Version, 4);
+        BitsetGameRecordFormat::appendFixed(header, this->_gamesPerBlock, 4);
+        this->writeBytes(header);
+    }
+
+    BitsetGameRecordWriter::~BitsetGameRecordWriter() {
+        if (this->_stream.is_open()) {
+            try {
+                this->close();
+            } catch (...) {
+            }
+        }
+    }
+
+    std::uint64_t BitsetGameRecordWriter::games() const {
+        return this->_games;
+    }
+
+    void BitsetGameRecordWriter::write(const BitsetGameRecord &record) {
+        if (!this->_stream.is_open()) {
+            throw std::runtime_error("The game record file is already closed.");
+        }
+
+        unsigned char flags = 0;
+        if (record.result != BitsetGameRecord::None) {
+            flags |= BitsetGameRecordFormat::HasResult;
+        }
+        if (!record.metadata.empty()) {
+            flags |= BitsetGameRecordFormat::HasMetadata;
+        }
+        this->_block.push_back(record.size);
+        this->_block.push_back(flags);
+        if (flags & BitsetGameRecordFormat::HasResult) {
+            this->_block.push_back(record.result);
+        }
+        BitsetGameRecordFormat::appendVarint(this->_block, record.moves.size());
+        this->_block.insert(this->_block.end(), record.moves.begin(), record.moves.end());
+        if (flags & BitsetGameRecordFormat::HasMetadata) {
+            BitsetGameRecordFormat::appendVarint(this->_block, record.metadata.size());
+            this->_block.insert(this->_block.end(), record.metadata.begin(), record.metadata.end());
+        }
+
+        this->_games++;
+        if (++this->_blockGames >= this->_gamesPerBlock) {
+            this->flushBlock();
+        }
+    }
+
+    void BitsetGameRecordWriter::close() {
+        if (!this->_stream.is_open()) {
+            return;
+        }
+        this->flushBlock();
+
+        auto indexOffset = this->_offset;
+        std::vector<unsigned char> trailer = {};
+        for (auto value : this->_index) {
+            BitsetGameRecordFormat::appendFixed(trailer, value, 8);
+        }
+        BitsetGameRecordFormat::appendFixed(trailer, indexOffset, 8);
+        BitsetGameRecordFormat::appendFixed(trailer, this->_index.size() / 2, 8);
+        BitsetGameRecordFormat::appendFixed(trailer, this->_games, 8);
+        trailer.insert(trailer.end(), BitsetGameRecordFormat::IndexMagic, BitsetGameRecordFormat::IndexMagic + 8);
+        this->writeBytes(trailer);
+
+        this->_stream.close();
+        if (this->_stream.fail()) {
+            throw std::runtime_error("The game record file could not be written.");
+        }
+    }
+
+    void BitsetGameRecordWriter::flushBlock() {
+        MOSAICGAME_TRACE_SPAN("writeBlock", "record");
+        if (this->_blockGames == 0) {
+            return;
+        }
+
+        auto codec = BitsetGameRecordFormat::Stored;
+        const std::vector<unsigned char> *stored = &this->_block;
+#ifdef MOSAICGAME_WITH_ZLIB
+        std::vector<unsigned char> compressed = {};
+        if (this->_compressed) {
+            auto compressedLength = compressBound(this->_block.size());
+            compressed.resize(compressedLength);
+            if (compress2(compressed.data(), &compressedLength, this->_block.data(), this->_block.size(),
+                          Z_BEST_SPEED) != Z_OK) {
+                throw std::runtime_error("The game record block could not be compressed.");
+            }
+            compressed.resize(compressedLength);
+            if (compressed.size() < this->_block.size()) {
+                codec = BitsetGameRecordFormat::Zlib;
+                stored = &compressed;
+            }
+        }
+#endif
+
+        this->_index.emplace_back(this->_offset);
+        this->_index.emplace_back(this->_games - this->_blockGames);
+
+        std::vector<unsigned char> header = {};
+        BitsetGameRecordFormat::appendFixed(header, stored->size(), 4);
+        BitsetGameRecordFormat::appendFixed(header, this->_block.size(), 4);
+        BitsetGameRecordFormat::appendFixed(header, this->_blockGames, 4);
+        BitsetGameRecordFormat::appendFixed(header, codec, 4);
+        this->writeBytes(header);
+        this->writeBytes(*stored);
+
+        this->_block.clear();
+        this->_blockGames = 0;
+    }
+
+    void BitsetGameRecordWriter::writeBytes(const std::vector<unsigned char> &bytes) {
+        this->_stream.write((const char *) bytes.data(), (std::streamsize) bytes.size());
+        if (!this->_stream) {
+            throw std::runtime_error("The game record file could not be written.");
+        }
+        this->_offset += bytes.size();
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef MOSAICGAME_BITSETGAMERECORDWRITER_H
+#define MOSAICGAME_BITSETGAMERECORDWRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "BitsetGameRecord.h"
+
+namespace MosaicGame::Record {
+    // Streams games into a record file, compressing every gamesPerBlock games into one block.
+    // The block index and footer are written by close().
+    class BitsetGameRecordWriter {
+    public:
+        explicit BitsetGameRecordWriter(const std::string &path, std::uint32_t gamesPerBlock = 256,
+                                        bool compressed = true);
+
+        BitsetGameRecordWriter(const BitsetGameRecordWriter &) = delete;
+
+        BitsetGameRecordWriter &operator=(const BitsetGameRecordWriter &) = delete;
+
+        ~BitsetGameRecordWriter();
+
+        [[nodiscard]] std::uint64_t games() const;
+
+        void write(const BitsetGameRecord &record);
+
+        void close();
+
+    private:
+        std::ofstream _stream;
+        std::uint32_t _gamesPerBlock;
+        bool _compressed;
+        std::uint64_t _offset;
+        std::uint64_t _games;
+        std::uint32_t _blockGames;
+        std::vector<unsigned char> _block;
+        std::vector<std::uint64_t> _index;
+
+        void flushBlock();
+
+        void writeBytes(const std::vector<unsigned char> &bytes);
+    };
+}
+
+#endif //MOSAICGAME_BITSETGAMERECORDWRITER_H
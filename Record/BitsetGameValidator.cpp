@@ -0,0 +1,69 @@
+#include "BitsetGameValidator.h"
+
+#include <algorithm>
+#include "../SelfPlay/WorkStealingPool.h"
+
+using MosaicGame::SelfPlay::WorkStealingPool;
+
+namespace MosaicGame::Record {
+
+    BitsetGameReport BitsetGameValidator::validate(unsigned char size, const unsigned char *moves, std::size_t count) {
+        BitsetGameReport report = {BitsetGameReport::Valid, false, 0, 0, 0, 0, 0, 0};
+        if (size < 1 || size > BitsetBoard::MaxSize) {
+            report.status = BitsetGameReport::InvalidSize;
+            return report;
+        }
+
+        auto position = BitsetPosition(size);
+        const auto cells = BitsetBoard::emptyBoard(size).flip().count();
+        unsigned int pieces = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            if (position.isOver()) {
+                report.status = BitsetGameReport::MoveAfterGameOver;
+                break;
+            }
+            auto move = BitsetMove(moves[i]);
+            if (moves[i] >= cells || !position.isLegalMove(move)) {
+                report.status = BitsetGameReport::IllegalMove;
+                break;
+            }
+            position = position.successor(move);
+            report.movesMade++;
+
+            auto placed = position.firstBoard().count() + position.secondBoard().count();
+            auto chained = placed - pieces - 1;
+            pieces = placed;
+            if (chained > 0) {
+                report.chainMoves++;
+                report.chainedPieces += chained;
+                report.longestChain = std::max<std::uint16_t>(report.longestChain, chained);
+            }
+        }
+
+        report.over = position.isOver();
+        report.firstScore = position.firstBoard().count();
+        report.secondScore = position.secondBoard().count();
+        return report;
+    }
+
+    std::vector<BitsetGameReport> BitsetGameValidator::validate(unsigned char size,
+                                                                const std::vector<std::vector<unsigned char>> &games,
+                                                                unsigned int threads) {
+        std::vector<BitsetGameReport> reports(games.size());
+        WorkStealingPool(threads).run(games.size(), [size, &games, &reports](std::size_t game, unsigned int) {
+            reports[game] = BitsetGameValidator::validate(size, games[game].data(), games[game].size());
+        });
+        return reports;
+    }
+
+    std::vector<BitsetGameReport> BitsetGameValidator::validate(const BitsetGameRecordReader &reader,
+                                                                unsigned int threads) {
+        std::vector<BitsetGameReport> reports(reader.games());
+        WorkStealingPool(threads).run(reader.blocks(), [&reader, &reports](std::size_t block, unsigned int) {
+            reader.readBlock(block, [&reports](std::uint64_t index, const BitsetGameRecord &record) {
+                reports[index] = BitsetGameValidator::validate(record.size, record.moves.data(), record.moves.size());
+            });
+        });
+        return reports;
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef MOSAICGAME_BITSETGAMEVALIDATOR_H
+#define MOSAICGAME_BITSETGAMEVALIDATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "BitsetGameRecordReader.h"
+
+namespace MosaicGame::Record {
+    struct BitsetGameReport {
+        enum Status : unsigned char {
+            Valid = 0,
+            InvalidSize = 1,
+            IllegalMove = 2,
+            MoveAfterGameOver = 3,
+        };
+
+        Status status;
+        bool over;
+        // Moves replayed before the first invalid one, i.e. the index of that move when not Valid.
+        std::uint32_t movesMade;
+        std::uint16_t firstScore;
+        std::uint16_t secondScore;
+        // Moves that set off a chain, pieces placed by chains, and the most placed by a single move.
+        std::uint16_t chainMoves;
+        std::uint16_t chainedPieces;
+        std::uint16_t longestChain;
+    };
+
+    // Replays games without exceptions and summarises each one. Invalid games stop at the first
+    // offending move and report the position reached before it.
+    class BitsetGameValidator {
+    public:
+        [[nodiscard]] static BitsetGameReport validate(unsigned char size, const unsigned char *moves, std::size_t count);
+
+        [[nodiscard]] static std::vector<BitsetGameReport> validate(unsigned char size,
+                                                                    const std::vector<std::vector<unsigned char>> &games,
+                                                                    unsigned int threads);
+
+        [[nodiscard]] static std::vector<BitsetGameReport> validate(const BitsetGameRecordReader &reader,
+                                                                    unsigned int threads);
+    };
+}
+
+#endif //MOSAICGAME_BITSETGAMEVALIDATOR_H
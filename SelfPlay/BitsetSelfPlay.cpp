@@ -0,0 +1,107 @@
+#include "BitsetSelfPlay.h"
+
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <utility>
+#include "BitsetShardWriter.h"
+#include "BoundedQueue.h"
+#include "WorkStealingPool.h"
+#include "../Engine/BitsetEngineFactory.h"
+#include "../Instrumentation/Tracer.h"
+
+using MosaicGame::Engine::BitsetEngineFactory;
+
+namespace MosaicGame::SelfPlay {
+
+    BitsetSelfPlay::BitsetSelfPlay(BitsetSelfPlayConfiguration configuration) :
+            _configuration(std::move(configuration)) {
+        if (this->_configuration.secondEngine.empty()) {
+            this->_configuration.secondEngine = this->_configuration.firstEngine;
+        }
+    }
+
+    BitsetSelfPlayRecord BitsetSelfPlay::play(std::size_t game) const {
+        MOSAICGAME_TRACE_SPAN("game", "selfplay");
+        auto firstEngine = BitsetEngineFactory::create(this->_configuration.firstEngine);
+        auto secondEngine = BitsetEngineFactory::create(this->_configuration.secondEngine);
+        auto seed = BitsetSelfPlay::gameSeed(this->_configuration.seed, game);
+
+        BitsetSelfPlayRecord record = {game, seed, this->_configuration.size, BitsetSelfPlayRecord::Unfinished, {}};
+        auto position = BitsetPosition(this->_configuration.size);
+        while (!position.isOver()) {
+            auto &engine = position.isFirstTurn() ? firstEngine : secondEngine;
+            auto result = engine->search(position, BitsetSelfPlay::gameSeed(seed, record.plies.size()));
+            BitsetSelfPlayPly ply = {(unsigned char) result.bestMove.toOffset(), {}};
+            ply.visits.reserve(result.visits.size());
+            for (const auto &[move, visits] : result.visits) {
+                ply.visits.emplace_back((unsigned char) move.toOffset(), visits);
+            }
+            record.plies.emplace_back(std::move(ply));
+            position = position.successor(result.bestMove);
+        }
+        if (position.firstWins()) {
+            record.result = BitsetSelfPlayRecord::FirstWins;
+        } else if (position.secondWins()) {
+            record.result = BitsetSelfPlayRecord::SecondWins;
+        }
+        return record;
+    }
+
+    std::size_t BitsetSelfPlay::run() {
+        const auto games = this->_configuration.games;
+        BoundedQueue<BitsetSelfPlayRecord> queue(this->_configuration.queueCapacity);
+        BitsetShardWriter writer(
+                this->_configuration.outputPrefix,
+                this->_configuration.gamesPerShard,
+                this->_configuration.flushGames
+        );
+
+        // The writer closes the queue when a write fails, so that blocked producers give up, and run() closes
+        // it once every game is queued, so that the writer drains it and finishes.
+        std::atomic<bool> stopped = false;
+        std::exception_ptr writerException = nullptr;
+        std::thread writerThread([&queue, &writer, &stopped, &writerException] {
+            try {
+                BitsetSelfPlayRecord record = {};
+                while (queue.pop(record)) {
+                    writer.write(record);
+                }
+                writer.close();
+            } catch (...) {
+                writerException = std::current_exception();
+                stopped = true;
+                queue.close();
+            }
+        });
+
+        try {
+            WorkStealingPool pool(this->_configuration.threads);
+            pool.run(games, [this, &queue, &stopped](std::size_t game, unsigned int) {
+                // Games left after a failed write would only be thrown away.
+                if (stopped.load(std::memory_order_acquire)) {
+                    return;
+                }
+                (void) queue.push(this->play(game));
+            });
+        } catch (...) {
+            queue.close();
+            writerThread.join();
+            throw;
+        }
+
+        queue.close();
+        writerThread.join();
+        if (writerException) {
+            std::rethrow_exception(writerException);
+        }
+        return writer.games();
+    }
+
+    std::uint64_t BitsetSelfPlay::gameSeed(std::uint64_t seed, std::uint64_t game) {
+        auto value = seed + 0x9e3779b97f4a7c15ULL * (game + 1);
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef MOSAICGAME_BITSETSELFPLAY_H
+#define MOSAICGAME_BITSETSELFPLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "BitsetSelfPlayRecord.h"
+
+namespace MosaicGame::SelfPlay {
+    struct BitsetSelfPlayConfiguration {
+        unsigned char size = 7;
+        std::size_t games = 1;
+        // Zero uses every hardware thread.
+        unsigned int threads = 0;
+        std::uint64_t seed = 0;
+        std::string firstEngine = "montecarlo";
+        // Empty plays firstEngine against itself.
+        std::string secondEngine;
+        std::string outputPrefix = "selfplay";
+        std::size_t gamesPerShard = 100000;
+        std::size_t flushGames = 1000;
+        std::size_t queueCapacity = 4096;
+    };
+
+    // Plays games on a work-stealing pool and streams their records through a bounded lock-free queue
+    // to a single shard writer. Every game and every move is seeded from the configuration seed and
+    // the game index, so a game's record does not depend on thread count or scheduling; only the
+    // order of records within the shards does.
+    class BitsetSelfPlay {
+    public:
+        explicit BitsetSelfPlay(BitsetSelfPlayConfiguration configuration);
+
+        [[nodiscard]] BitsetSelfPlayRecord play(std::size_t game) const;
+
+        // Returns the number of games written.
+        std::size_t run();
+
+        [[nodiscard]] static std::uint64_t gameSeed(std::uint64_t seed, std::uint64_t game);
+
+    private:
+        BitsetSelfPlayConfiguration _configuration;
+    };
+}
+
+#endif //MOSAICGAME_BITSETSELFPLAY_H
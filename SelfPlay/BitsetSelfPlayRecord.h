@@ -0,0 +1,30 @@
+#ifndef MOSAICGAME_BITSETSELFPLAYRECORD_H
+#define MOSAICGAME_BITSETSELFPLAYRECORD_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace MosaicGame::SelfPlay {
+    struct BitsetSelfPlayPly {
+        unsigned char move;
+        std::vector<std::pair<unsigned char, unsigned int>> visits;
+    };
+
+    // Positions are not stored: they are recovered by replaying the moves from the initial position.
+    struct BitsetSelfPlayRecord {
+        enum Result : unsigned char {
+            Unfinished = 0,
+            FirstWins = 1,
+            SecondWins = 2,
+        };
+
+        std::uint64_t game;
+        std::uint64_t seed;
+        unsigned char size;
+        Result result;
+        std::vector<BitsetSelfPlayPly> plies;
+    };
+}
+
+#endif //MOSAICGAME_BITSETSELFPLAYRECORD_H
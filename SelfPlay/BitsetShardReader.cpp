@@ -0,0 +1,81 @@
+#include "BitsetShardReader.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include "BitsetShardWriter.h"
+
+namespace MosaicGame::SelfPlay {
+
+    std::vector<BitsetSelfPlayRecord> BitsetShardReader::read(const std::string &path) {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream) {
+            throw std::runtime_error("The self-play shard could not be opened.");
+        }
+        std::vector<unsigned char> data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+        std::size_t position = 0;
+        auto byte = [&data, &position]() -> unsigned char {
+            if (position >= data.size()) {
+                throw std::runtime_error("The self-play shard is truncated.");
+            }
+            return data[position++];
+        };
+        auto fixed = [&byte](unsigned int bytes) {
+            std::uint64_t value = 0;
+            for (unsigned int i = 0; i < bytes; i++) {
+                value |= (std::uint64_t) byte() << (i * 8);
+            }
+            return value;
+        };
+        auto varint = [&byte]() {
+            std::uint64_t value = 0;
+            for (unsigned int shift = 0;; shift += 7) {
+                auto b = byte();
+                value |= (std::uint64_t) (b & 0x7f) << shift;
+                if (!(b & 0x80)) {
+                    return value;
+                }
+            }
+        };
+
+        if (data.size() < 16 || std::memcmp(data.data(), BitsetShardWriter::Magic, 8) != 0) {
+            throw std::runtime_error("The self-play shard is malformed.");
+        }
+        position = 8;
+        if (fixed(4) != BitsetShardWriter::Version) {
+            throw std::runtime_error("The self-play shard version is not supported.");
+        }
+        fixed(4);
+
+        std::vector<BitsetSelfPlayRecord> records = {};
+        while (position < data.size()) {
+            BitsetSelfPlayRecord record = {};
+            record.game = fixed(8);
+            record.seed = fixed(8);
+            record.size = byte();
+            record.result = (BitsetSelfPlayRecord::Result) byte();
+            record.plies.resize(varint());
+            for (auto &ply : record.plies) {
+                ply.move = byte();
+                ply.visits.resize(varint());
+                for (auto &visit : ply.visits) {
+                    visit.first = byte();
+                    visit.second = (unsigned int) varint();
+                }
+            }
+            records.emplace_back(std::move(record));
+        }
+        return records;
+    }
+
+    std::vector<BitsetPosition> BitsetShardReader::positions(const BitsetSelfPlayRecord &record) {
+        std::vector<BitsetPosition> positions = {BitsetPosition(record.size)};
+        positions.reserve(record.plies.size() + 1);
+        for (const auto &ply : record.plies) {
+            positions.emplace_back(positions.back().successor(BitsetMove(ply.move)));
+        }
+        return positions;
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef MOSAICGAME_BITSETSHARDREADER_H
+#define MOSAICGAME_BITSETSHARDREADER_H
+
+#include <string>
+#include <vector>
+#include "BitsetSelfPlayRecord.h"
+#include "../Game/BitsetPosition.h"
+
+using MosaicGame::Game::BitsetPosition;
+
+namespace MosaicGame::SelfPlay {
+    class BitsetShardReader {
+    public:
+        [[nodiscard]] static std::vector<BitsetSelfPlayRecord> read(const std::string &path);
+
+        // Positions before each ply followed by the final position.
+        [[nodiscard]] static std::vector<BitsetPosition> positions(const BitsetSelfPlayRecord &record);
+    };
+}
+
+#endif //MOSAICGAME_BITSETSHARDREADER_H
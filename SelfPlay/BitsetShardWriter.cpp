@@ -0,0 +1,99 @@
+#include "BitsetShardWriter.h"
+
+#include <cstdio>
+#include <stdexcept>
+#include <utility>
+#include "../Instrumentation/Tracer.h"
+
+namespace MosaicGame::SelfPlay {
+
+    BitsetShardWriter::BitsetShardWriter(std::string prefix, std::size_t gamesPerShard, std::size_t flushGames) :
+            _prefix(std::move(prefix)),
+            _gamesPerShard(gamesPerShard == 0 ? 1 : gamesPerShard),
+            _flushGames(flushGames == 0 ? 1 : flushGames),
+            _shards(0),
+            _games(0),
+            _shardGames(0),
+            _stream(),
+            _buffer() {}
+
+    BitsetShardWriter::~BitsetShardWriter() {
+        this->close();
+    }
+
+    std::size_t BitsetShardWriter::shards() const {
+        return this->_shards;
+    }
+
+    std::size_t BitsetShardWriter::games() const {
+        return this->_games;
+    }
+
+    void BitsetShardWriter::write(const BitsetSelfPlayRecord &record) {
+        MOSAICGAME_TRACE_SPAN("write", "record");
+        if (!this->_stream.is_open() || this->_shardGames >= this->_gamesPerShard) {
+            this->openShard();
+        }
+
+        this->_buffer.clear();
+        BitsetShardWriter::appendFixed(this->_buffer, record.game, 8);
+        BitsetShardWriter::appendFixed(this->_buffer, record.seed, 8);
+        this->_buffer.push_back((char) record.size);
+        this->_buffer.push_back((char) record.result);
+        BitsetShardWriter::appendVarint(this->_buffer, record.plies.size());
+        for (const auto &ply : record.plies) {
+            this->_buffer.push_back((char) ply.move);
+            BitsetShardWriter::appendVarint(this->_buffer, ply.visits.size());
+            for (const auto &[move, visits] : ply.visits) {
+                this->_buffer.push_back((char) move);
+                BitsetShardWriter::appendVarint(this->_buffer, visits);
+            }
+        }
+        this->_stream.write(this->_buffer.data(), (std::streamsize) this->_buffer.size());
+
+        this->_games++;
+        this->_shardGames++;
+        if (this->_games % this->_flushGames == 0) {
+            this->_stream.flush();
+        }
+        if (!this->_stream) {
+            throw std::runtime_error("The self-play shard could not be written.");
+        }
+    }
+
+    void BitsetShardWriter::close() {
+        if (this->_stream.is_open()) {
+            this->_stream.close();
+        }
+    }
+
+    void BitsetShardWriter::appendVarint(std::vector<char> &buffer, std::uint64_t value) {
+        while (value >= 0x80) {
+            buffer.push_back((char) (value | 0x80));
+            value >>= 7;
+        }
+        buffer.push_back((char) value);
+    }
+
+    void BitsetShardWriter::appendFixed(std::vector<char> &buffer, std::uint64_t value, unsigned int bytes) {
+        for (unsigned int i = 0; i < bytes; i++) {
+            buffer.push_back((char) (value >> (i * 8)));
+        }
+    }
+
+    void BitsetShardWriter::openShard() {
+        this->close();
+        char suffix[16];
+        std::snprintf(suffix, sizeof(suffix), "-%05zu.bin", this->_shards);
+        this->_stream.open(this->_prefix + suffix, std::ios::binary | std::ios::trunc);
+        if (!this->_stream) {
+            throw std::runtime_error("The self-play shard could not be opened.");
+        }
+        this->_buffer.assign(BitsetShardWriter::Magic, BitsetShardWriter::Magic + sizeof(BitsetShardWriter::Magic));
+        BitsetShardWriter::appendFixed(this->_buffer, BitsetShardWriter::Version, 4);
+        BitsetShardWriter::appendFixed(this->_buffer, 0, 4);
+        this->_stream.write(this->_buffer.data(), (std::streamsize) this->_buffer.size());
+        this->_shards++;
+        this->_shardGames = 0;
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef MOSAICGAME_BITSETSHARDWRITER_H
+#define MOSAICGAME_BITSETSHARDWRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "BitsetSelfPlayRecord.h"
+
+namespace MosaicGame::SelfPlay {
+    // Appends self-play records to "<prefix>-<shard>.bin" files, starting a new shard every
+    // gamesPerShard records and flushing every flushGames records.
+    //
+    // Shard layout: 8-byte magic "MGSHARD", uint32 version, uint32 reserved, then records of
+    // uint64 game, uint64 seed, uint8 size, uint8 result, varint plies and, per ply, uint8 move,
+    // varint visit entries and (uint8 move, varint visits) pairs. Integers are little-endian.
+    class BitsetShardWriter {
+    public:
+        explicit BitsetShardWriter(std::string prefix, std::size_t gamesPerShard, std::size_t flushGames);
+
+        BitsetShardWriter(const BitsetShardWriter &) = delete;
+
+        BitsetShardWriter &operator=(const BitsetShardWriter &) = delete;
+
+        ~BitsetShardWriter();
+
+        [[nodiscard]] std::size_t shards() const;
+
+        [[nodiscard]] std::size_t games() const;
+
+        void write(const BitsetSelfPlayRecord &record);
+
+        void close();
+
+        static constexpr char Magic[8] = {'M', 'G', 'S', 'H', 'A', 'R', 'D', '\0'};
+
+        static constexpr std::uint32_t Version = 1;
+
+        static void appendVarint(std::vector<char> &buffer, std::uint64_t value);
+
+        static void appendFixed(std::vector<char> &buffer, std::uint64_t value, unsigned int bytes);
+
+    private:
+        std::string _prefix;
+        std::size_t _gamesPerShard;
+        std::size_t _flushGames;
+        std::size_t _shards;
+        std::size_t _games;
+        std::size_t _shardGames;
+        std::ofstream _stream;
+        std::vector<char> _buffer;
+
+        void openShard();
+    };
+}
+
+#endif //MOSAICGAME_BITSETSHARDWRITER_H
@@ -0,0 +1,145 @@
+#ifndef MOSAICGAME_BOUNDEDQUEUE_H
+#define MOSAICGAME_BOUNDEDQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace MosaicGame::SelfPlay {
+    // Lock-free multi-producer multi-consumer ring buffer (Vyukov). The capacity is rounded up to a
+    // power of two; tryPush and tryPop fail instead of blocking when the queue is full or empty, while
+    // push and pop sleep on a counter of completed pops or pushes until they can go ahead or the queue
+    // is closed.
+    template<class T>
+    class BoundedQueue {
+    public:
+        explicit BoundedQueue(std::size_t capacity) :
+                _capacity(BoundedQueue::roundUp(capacity)),
+                _cells(std::make_unique<Cell[]>(_capacity)),
+                _enqueuePosition(0),
+                _dequeuePosition(0),
+                _pushes(0),
+                _pops(0),
+                _closed(false) {
+            for (std::size_t i = 0; i < this->_capacity; i++) {
+                this->_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        BoundedQueue(const BoundedQueue &) = delete;
+
+        BoundedQueue &operator=(const BoundedQueue &) = delete;
+
+        [[nodiscard]] std::size_t capacity() const {
+            return this->_capacity;
+        }
+
+        bool tryPush(T &&value) {
+            auto position = this->_enqueuePosition.load(std::memory_order_relaxed);
+            while (true) {
+                auto &cell = this->_cells[position & (this->_capacity - 1)];
+                auto sequence = cell.sequence.load(std::memory_order_acquire);
+                auto difference = (std::ptrdiff_t) sequence - (std::ptrdiff_t) position;
+                if (difference == 0) {
+                    if (this->_enqueuePosition.compare_exchange_weak(position, position + 1,
+                                                                     std::memory_order_relaxed)) {
+                        cell.value = std::move(value);
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        this->_pushes.fetch_add(1, std::memory_order_release);
+                        this->_pushes.notify_one();
+                        return true;
+                    }
+                } else if (difference < 0) {
+                    return false;
+                } else {
+                    position = this->_enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool tryPop(T &value) {
+            auto position = this->_dequeuePosition.load(std::memory_order_relaxed);
+            while (true) {
+                auto &cell = this->_cells[position & (this->_capacity - 1)];
+                auto sequence = cell.sequence.load(std::memory_order_acquire);
+                auto difference = (std::ptrdiff_t) sequence - (std::ptrdiff_t) (position + 1);
+                if (difference == 0) {
+                    if (this->_dequeuePosition.compare_exchange_weak(position, position + 1,
+                                                                     std::memory_order_relaxed)) {
+                        value = std::move(cell.value);
+                        cell.sequence.store(position + this->_capacity, std::memory_order_release);
+                        this->_pops.fetch_add(1, std::memory_order_release);
+                        this->_pops.notify_one();
+                        return true;
+                    }
+                } else if (difference < 0) {
+                    return false;
+                } else {
+                    position = this->_dequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Waits while the queue is full. Returns false, leaving the value in place, once the queue is closed.
+        bool push(T &&value) {
+            while (true) {
+                auto pops = this->_pops.load(std::memory_order_acquire);
+                if (this->_closed.load(std::memory_order_acquire)) {
+                    return false;
+                }
+                if (this->tryPush(std::move(value))) {
+                    return true;
+                }
+                this->_pops.wait(pops, std::memory_order_acquire);
+            }
+        }
+
+        // Waits while the queue is empty. Returns false once the queue is closed and drained.
+        bool pop(T &value) {
+            while (true) {
+                auto pushes = this->_pushes.load(std::memory_order_acquire);
+                if (this->tryPop(value)) {
+                    return true;
+                }
+                if (this->_closed.load(std::memory_order_acquire)) {
+                    return this->tryPop(value);
+                }
+                this->_pushes.wait(pushes, std::memory_order_acquire);
+            }
+        }
+
+        // Wakes every waiting push and pop; later pushes fail and pops only drain what is left.
+        void close() {
+            this->_closed.store(true, std::memory_order_release);
+            this->_pushes.fetch_add(1, std::memory_order_release);
+            this->_pushes.notify_all();
+            this->_pops.fetch_add(1, std::memory_order_release);
+            this->_pops.notify_all();
+        }
+
+    private:
+        struct Cell {
+            std::atomic<std::size_t> sequence;
+            T value;
+        };
+
+        const std::size_t _capacity;
+        std::unique_ptr<Cell[]> _cells;
+        alignas(64) std::atomic<std::size_t> _enqueuePosition;
+        alignas(64) std::atomic<std::size_t> _dequeuePosition;
+        alignas(64) std::atomic<std::size_t> _pushes;
+        alignas(64) std::atomic<std::size_t> _pops;
+        std::atomic<bool> _closed;
+
+        static std::size_t roundUp(std::size_t capacity) {
+            std::size_t rounded = 2;
+            while (rounded < capacity) {
+                rounded <<= 1;
+            }
+            return rounded;
+        }
+    };
+}
+
+#endif //MOSAICGAME_BOUNDEDQUEUE_H
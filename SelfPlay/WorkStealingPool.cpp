@@ -0,0 +1,148 @@
+#include "WorkStealingPool.h"
+
+#include <algorithm>
+#include "../Instrumentation/Tracer.h"
+
+namespace MosaicGame::SelfPlay {
+
+    WorkStealingPool::WorkStealingPool(unsigned int threads) :
+            _threads(threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threads),
+            _workers{},
+            _task(nullptr),
+            _generation(0),
+            _running(0),
+            _stopping(false),
+            _exception(nullptr),
+            _failed(false),
+            _helpers{} {
+        for (unsigned int i = 0; i < this->_threads; i++) {
+            this->_workers.emplace_back(std::make_unique<Worker>());
+        }
+        for (unsigned int worker = 1; worker < this->_threads; worker++) {
+            this->_helpers.emplace_back([this, worker] {
+                this->help(worker);
+            });
+        }
+    }
+
+    WorkStealingPool::~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_stopping = true;
+        }
+        this->_started.notify_all();
+        for (auto &helper : this->_helpers) {
+            helper.join();
+        }
+    }
+
+    unsigned int WorkStealingPool::threads() const {
+        return this->_threads;
+    }
+
+    void WorkStealingPool::run(std::size_t count, const std::function<void(std::size_t, unsigned int)> &task) {
+        std::lock_guard<std::mutex> runLock(this->_runMutex);
+        auto share = count / this->_threads;
+        auto extra = count % this->_threads;
+        for (unsigned int worker = 0; worker < this->_threads; worker++) {
+            auto &range = *this->_workers[worker];
+            range.begin = worker * share + std::min<std::size_t>(worker, extra);
+            range.end = range.begin + share + (worker < extra ? 1 : 0);
+        }
+
+        this->_failed.store(false, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_task = &task;
+            this->_exception = nullptr;
+            this->_running = this->_threads - 1;
+            this->_generation++;
+        }
+        this->_started.notify_all();
+        this->work(0);
+
+        std::exception_ptr exception = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(this->_mutex);
+            this->_finished.wait(lock, [this] {
+                return this->_running == 0;
+            });
+            this->_task = nullptr;
+            std::swap(exception, this->_exception);
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    void WorkStealingPool::help(unsigned int worker) {
+        std::uint64_t generation = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(this->_mutex);
+                this->_started.wait(lock, [this, generation] {
+                    return this->_stopping || this->_generation != generation;
+                });
+                if (this->_stopping) {
+                    return;
+                }
+                generation = this->_generation;
+            }
+            this->work(worker);
+            {
+                std::lock_guard<std::mutex> lock(this->_mutex);
+                if (--this->_running == 0) {
+                    this->_finished.notify_one();
+                }
+            }
+        }
+    }
+
+    void WorkStealingPool::work(unsigned int worker) {
+        while (!this->_failed.load(std::memory_order_relaxed)) {
+            auto index = this->next(worker);
+            if (!index) {
+                return;
+            }
+            try {
+                MOSAICGAME_TRACE_SPAN("task", "pool");
+                (*this->_task)(*index, worker);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(this->_mutex);
+                if (!this->_exception) {
+                    this->_exception = std::current_exception();
+                }
+                this->_failed = true;
+            }
+        }
+    }
+
+    std::optional<std::size_t> WorkStealingPool::next(unsigned int worker) {
+        auto &own = *this->_workers[worker];
+        {
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (own.begin < own.end) {
+                return own.begin++;
+            }
+        }
+        for (unsigned int i = 1; i < this->_threads; i++) {
+            auto &victim = *this->_workers[(worker + i) % this->_threads];
+            std::size_t begin;
+            std::size_t end;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (victim.begin == victim.end) {
+                    continue;
+                }
+                begin = victim.begin + (victim.end - victim.begin) / 2;
+                end = victim.end;
+                victim.end = begin;
+            }
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.begin = begin + 1;
+            own.end = end;
+            return begin;
+        }
+        return std::nullopt;
+    }
+}
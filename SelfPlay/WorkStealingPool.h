@@ -0,0 +1,68 @@
+#ifndef MOSAICGAME_WORKSTEALINGPOOL_H
+#define MOSAICGAME_WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace MosaicGame::SelfPlay {
+    // Runs indexed tasks on a fixed number of threads, started once and reused by every run(). Each worker
+    // is seeded with a contiguous range of indices and takes them from the front; once it runs dry it steals
+    // the back half of another worker's range, so uneven task lengths balance out.
+    class WorkStealingPool {
+    public:
+        explicit WorkStealingPool(unsigned int threads);
+
+        WorkStealingPool(const WorkStealingPool &) = delete;
+
+        WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+        ~WorkStealingPool();
+
+        [[nodiscard]] unsigned int threads() const;
+
+        // Calls task(index, worker) for every index in [0, count) and returns once all have finished. The
+        // calling thread works as worker 0, and concurrent calls run one after the other. The first exception
+        // thrown by a task is rethrown after the remaining workers stop.
+        void run(std::size_t count, const std::function<void(std::size_t, unsigned int)> &task);
+
+    private:
+        // The indices [begin, end) not yet taken.
+        struct Worker {
+            std::mutex mutex;
+            std::size_t begin;
+            std::size_t end;
+        };
+
+        unsigned int _threads;
+        std::vector<std::unique_ptr<Worker>> _workers;
+        std::mutex _runMutex;
+        // Guards the fields below; helpers wait on _started for the next generation or _stopping.
+        std::mutex _mutex;
+        std::condition_variable _started;
+        std::condition_variable _finished;
+        const std::function<void(std::size_t, unsigned int)> *_task;
+        std::uint64_t _generation;
+        unsigned int _running;
+        bool _stopping;
+        std::exception_ptr _exception;
+        std::atomic<bool> _failed;
+        std::vector<std::thread> _helpers;
+
+        void help(unsigned int worker);
+
+        void work(unsigned int worker);
+
+        [[nodiscard]] std::optional<std::size_t> next(unsigned int worker);
+    };
+}
+
+#endif //MOSAICGAME_WORKSTEALINGPOOL_H
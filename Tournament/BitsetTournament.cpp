@@ -0,0 +1,136 @@
+#include "BitsetTournament.h"
+
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <set>
+#include <utility>
+#include "../Book/BitsetOpeningBook.h"
+#include "../Engine/BitsetEngineFactory.h"
+#include "../Game/BitsetPosition.h"
+#include "../Instrumentation/Tracer.h"
+#include "../SelfPlay/BitsetSelfPlay.h"
+#include "../SelfPlay/WorkStealingPool.h"
+
+using MosaicGame::Book::BitsetOpeningBook;
+using MosaicGame::Book::BitsetOpeningBookKey;
+using MosaicGame::Engine::BitsetEngineFactory;
+using MosaicGame::Engine::BitsetSearchControl;
+using MosaicGame::Game::BitsetPosition;
+using MosaicGame::SelfPlay::BitsetSelfPlay;
+using MosaicGame::SelfPlay::WorkStealingPool;
+
+namespace MosaicGame::Tournament {
+
+    BitsetTournament::BitsetTournament(BitsetTournamentConfiguration configuration) :
+            _configuration(std::move(configuration)) {}
+
+    std::vector<std::vector<BitsetMove>> BitsetTournament::openings() const {
+        const auto wanted = this->_configuration.pairs;
+        auto random = std::mt19937_64(BitsetSelfPlay::gameSeed(this->_configuration.seed, ~0ULL));
+        std::set<BitsetOpeningBookKey> keys = {};
+        std::vector<std::vector<BitsetMove>> openings = {};
+        for (std::size_t attempt = 0; openings.size() < wanted && attempt < 16 * wanted; attempt++) {
+            auto position = BitsetPosition(this->_configuration.size);
+            std::vector<BitsetMove> moves = {};
+            while (moves.size() < this->_configuration.openingPlies && !position.isOver()) {
+                auto legalMoves = BitsetMove::fromBoard(position.legalBoard());
+                moves.emplace_back(legalMoves[random() % legalMoves.size()]);
+                position = position.successor(moves.back());
+            }
+            if (position.isOver()) {
+                continue;
+            }
+            auto key = BitsetOpeningBook::key(position, BitsetOpeningBook::canonicalSymmetry(position));
+            if (keys.insert(key).second) {
+                openings.emplace_back(std::move(moves));
+            }
+        }
+        return openings;
+    }
+
+    bool BitsetTournament::play(const std::vector<BitsetMove> &opening, bool candidateFirst, std::uint64_t seed,
+                                bool &timeLoss) const {
+        using Clock = BitsetSearchControl::Clock;
+        MOSAICGAME_TRACE_SPAN("game", "tournament");
+
+        auto candidate = BitsetEngineFactory::create(this->_configuration.candidateEngine);
+        auto baseline = BitsetEngineFactory::create(this->_configuration.baselineEngine);
+        auto position = BitsetPosition(this->_configuration.size);
+        for (const auto &move: opening) {
+            position = position.successor(move);
+        }
+
+        const auto clocked = this->_configuration.baseTime.count() > 0;
+        Clock::duration clocks[2] = {this->_configuration.baseTime, this->_configuration.baseTime};
+        timeLoss = false;
+        for (std::uint64_t ply = 0; !position.isOver(); ply++) {
+            auto side = position.isFirstTurn() ? 0 : 1;
+            auto &engine = (side == 0) == candidateFirst ? candidate : baseline;
+            BitsetSearchControl control;
+            auto start = Clock::now();
+            if (clocked) {
+                control.setDeadline(start + clocks[side] / 20 + this->_configuration.increment);
+            }
+            auto result = engine->search(position, BitsetSelfPlay::gameSeed(seed, ply), control);
+            if (clocked) {
+                clocks[side] -= Clock::now() - start;
+                if (clocks[side].count() <= 0) {
+                    timeLoss = true;
+                    return (side == 0) != candidateFirst;
+                }
+                clocks[side] += this->_configuration.increment;
+            }
+            position = position.successor(result.bestMove);
+        }
+        return position.firstWins() == candidateFirst;
+    }
+
+    BitsetTournamentResult BitsetTournament::run() const {
+        const auto &configuration = this->_configuration;
+        auto openings = this->openings();
+        if (openings.empty()) {
+            openings.emplace_back();
+        }
+
+        BitsetTournamentResult result = {{}, 0, 0, 0, openings.size(), 0.0, BitsetTournamentResult::Undecided};
+        const auto lower = std::log(configuration.beta / (1.0 - configuration.alpha));
+        const auto upper = std::log((1.0 - configuration.beta) / configuration.alpha);
+        std::mutex mutex;
+        std::atomic<bool> decided = false;
+        WorkStealingPool(configuration.threads).run(configuration.pairs, [&](std::size_t pair, unsigned int) {
+            if (decided.load(std::memory_order_relaxed)) {
+                return;
+            }
+            const auto &opening = openings[pair % openings.size()];
+            auto seed = BitsetSelfPlay::gameSeed(configuration.seed, pair);
+            bool firstTimeLoss = false;
+            bool secondTimeLoss = false;
+            auto firstWin = this->play(opening, true, seed, firstTimeLoss);
+            auto secondWin = this->play(opening, false, seed, secondTimeLoss);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (result.decision != BitsetTournamentResult::Undecided) {
+                return;
+            }
+            result.statistics.addPair((firstWin ? 1 : 0) + (secondWin ? 1 : 0));
+            result.candidateWins += (firstWin ? 1 : 0) + (secondWin ? 1 : 0);
+            result.baselineWins += (firstWin ? 0 : 1) + (secondWin ? 0 : 1);
+            result.timeLosses += (firstTimeLoss ? 1 : 0) + (secondTimeLoss ? 1 : 0);
+            if (configuration.sprt) {
+                result.logLikelihoodRatio = result.statistics.logLikelihoodRatio(
+                        configuration.elo0,
+                        configuration.elo1
+                );
+                if (result.logLikelihoodRatio <= lower) {
+                    result.decision = BitsetTournamentResult::AcceptH0;
+                } else if (result.logLikelihoodRatio >= upper) {
+                    result.decision = BitsetTournamentResult::AcceptH1;
+                }
+                decided.store(result.decision != BitsetTournamentResult::Undecided, std::memory_order_relaxed);
+            }
+        });
+        return result;
+    }
+}
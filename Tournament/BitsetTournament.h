@@ -0,0 +1,72 @@
+#ifndef MOSAICGAME_BITSETTOURNAMENT_H
+#define MOSAICGAME_BITSETTOURNAMENT_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "TournamentStatistics.h"
+#include "../Game/Move/BitsetMove.h"
+
+using MosaicGame::Game::Move::BitsetMove;
+
+namespace MosaicGame::Tournament {
+    struct BitsetTournamentConfiguration {
+        unsigned char size = 5;
+        std::string candidateEngine = "montecarlo";
+        std::string baselineEngine = "random";
+        // Upper bound on colour-swapped pairs; SPRT may stop earlier.
+        std::size_t pairs = 100;
+        // Zero uses every hardware thread.
+        unsigned int threads = 0;
+        std::uint64_t seed = 0;
+        // Random plies in each opening before the engines take over.
+        unsigned int openingPlies = 2;
+        // A zero base time plays without clocks.
+        std::chrono::milliseconds baseTime = std::chrono::milliseconds(0);
+        std::chrono::milliseconds increment = std::chrono::milliseconds(0);
+        bool sprt = false;
+        double elo0 = 0.0;
+        double elo1 = 10.0;
+        double alpha = 0.05;
+        double beta = 0.05;
+    };
+
+    struct BitsetTournamentResult {
+        enum Decision : unsigned char {
+            Undecided = 0,
+            AcceptH0 = 1,
+            AcceptH1 = 2,
+        };
+
+        TournamentStatistics statistics;
+        std::size_t candidateWins;
+        std::size_t baselineWins;
+        std::size_t timeLosses;
+        std::size_t openings;
+        double logLikelihoodRatio;
+        Decision decision;
+    };
+
+    // Plays the candidate against the baseline on a work-stealing pool. Every pair replays one opening
+    // from a suite of positions that are distinct up to symmetry, once with each engine moving first.
+    class BitsetTournament {
+    public:
+        explicit BitsetTournament(BitsetTournamentConfiguration configuration);
+
+        // Deterministic for a given configuration; each entry is the move sequence of one opening.
+        [[nodiscard]] std::vector<std::vector<BitsetMove>> openings() const;
+
+        // Plays one game and returns whether the candidate won; timeLoss is set when a clock ran out.
+        [[nodiscard]] bool play(const std::vector<BitsetMove> &opening, bool candidateFirst, std::uint64_t seed,
+                                bool &timeLoss) const;
+
+        [[nodiscard]] BitsetTournamentResult run() const;
+
+    private:
+        BitsetTournamentConfiguration _configuration;
+    };
+}
+
+#endif //MOSAICGAME_BITSETTOURNAMENT_H
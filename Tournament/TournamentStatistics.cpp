@@ -0,0 +1,89 @@
+#include "TournamentStatistics.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace MosaicGame::Tournament {
+
+    TournamentStatistics::TournamentStatistics() : _pairs({0, 0, 0}) {}
+
+    void TournamentStatistics::addPair(unsigned int points) {
+        if (points > 2) {
+            throw std::runtime_error("A game pair scores at most two points.");
+        }
+        this->_pairs[points]++;
+    }
+
+    std::size_t TournamentStatistics::pairs() const {
+        return this->_pairs[0] + this->_pairs[1] + this->_pairs[2];
+    }
+
+    std::size_t TournamentStatistics::pairs(unsigned int points) const {
+        return this->_pairs.at(points);
+    }
+
+    double TournamentStatistics::score() const {
+        auto pairs = this->pairs();
+        if (pairs == 0) {
+            return 0.5;
+        }
+        return (0.5 * this->_pairs[1] + this->_pairs[2]) / pairs;
+    }
+
+    double TournamentStatistics::elo() const {
+        return TournamentStatistics::scoreToElo(this->score());
+    }
+
+    std::pair<double, double> TournamentStatistics::eloInterval(double z) const {
+        auto pairs = this->pairs();
+        if (pairs < 2) {
+            return {-std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()};
+        }
+        auto error = z * std::sqrt(this->variance(0.0) / pairs);
+        return {
+                TournamentStatistics::scoreToElo(this->score() - error),
+                TournamentStatistics::scoreToElo(this->score() + error),
+        };
+    }
+
+    double TournamentStatistics::logLikelihoodRatio(double elo0, double elo1) const {
+        auto pairs = this->pairs();
+        if (pairs == 0) {
+            return 0.0;
+        }
+        // Half a pseudo pair per outcome keeps the variance positive while every pair has ended alike.
+        auto variance = this->variance(0.5);
+        auto score0 = TournamentStatistics::eloToScore(elo0);
+        auto score1 = TournamentStatistics::eloToScore(elo1);
+        return (score1 - score0) * (2.0 * this->score() - score0 - score1) * pairs / (2.0 * variance);
+    }
+
+    double TournamentStatistics::eloToScore(double elo) {
+        return 1.0 / (1.0 + std::pow(10.0, -elo / 400.0));
+    }
+
+    double TournamentStatistics::scoreToElo(double score) {
+        if (score <= 0.0) {
+            return -std::numeric_limits<double>::infinity();
+        }
+        if (score >= 1.0) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return -400.0 * std::log10(1.0 / score - 1.0);
+    }
+
+    double TournamentStatistics::variance(double pseudoCount) const {
+        const double points[3] = {0.0, 0.5, 1.0};
+        auto total = this->pairs() + 3 * pseudoCount;
+        auto mean = 0.0;
+        for (unsigned int i = 0; i < 3; i++) {
+            mean += points[i] * (this->_pairs[i] + pseudoCount) / total;
+        }
+        auto variance = 0.0;
+        for (unsigned int i = 0; i < 3; i++) {
+            variance += (points[i] - mean) * (points[i] - mean) * (this->_pairs[i] + pseudoCount) / total;
+        }
+        return variance;
+    }
+}
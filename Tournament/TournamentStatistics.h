@@ -0,0 +1,43 @@
+#ifndef MOSAICGAME_TOURNAMENTSTATISTICS_H
+#define MOSAICGAME_TOURNAMENTSTATISTICS_H
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace MosaicGame::Tournament {
+    // Match statistics over colour-swapped game pairs. Each pair scores 0, 1 or 2 points for the
+    // candidate; treating pairs rather than games as the samples absorbs the first-move advantage.
+    class TournamentStatistics {
+    public:
+        TournamentStatistics();
+
+        void addPair(unsigned int points);
+
+        [[nodiscard]] std::size_t pairs() const;
+
+        [[nodiscard]] std::size_t pairs(unsigned int points) const;
+
+        // Mean score per game, between 0 and 1.
+        [[nodiscard]] double score() const;
+
+        [[nodiscard]] double elo() const;
+
+        // Elo interval of the score plus or minus z standard errors.
+        [[nodiscard]] std::pair<double, double> eloInterval(double z) const;
+
+        // Log-likelihood ratio of elo1 against elo0 under a normal approximation of the pair scores.
+        [[nodiscard]] double logLikelihoodRatio(double elo0, double elo1) const;
+
+        [[nodiscard]] static double eloToScore(double elo);
+
+        [[nodiscard]] static double scoreToElo(double score);
+
+    private:
+        std::array<std::size_t, 3> _pairs;
+
+        [[nodiscard]] double variance(double pseudoCount) const;
+    };
+}
+
+#endif //MOSAICGAME_TOURNAMENTSTATISTICS_H
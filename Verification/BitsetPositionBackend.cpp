@@ -0,0 +1,132 @@
+#include "BitsetPositionBackend.h"
+
+namespace MosaicGame::Verification {
+
+    BitsetPositionBackend::BitsetPositionBackend() : _status(GameStatus::Ok) {}
+
+    std::string BitsetPositionBackend::name() const {
+        return "bitset-position";
+    }
+
+    unsigned char BitsetPositionBackend::maxSize() const {
+        return BitsetBoard::MaxSize;
+    }
+
+    void BitsetPositionBackend::reset(unsigned char size) {
+        this->_positions = {BitsetPosition(size)};
+        this->_redoPositions.clear();
+        this->_status = GameStatus::Ok;
+    }
+
+    GameStatus BitsetPositionBackend::apply(const DifferentialAction &action) {
+        switch (action.kind) {
+            case DifferentialAction::Move: {
+                const auto &position = this->_positions.back();
+                auto cells = BitsetBoard::emptyBoard(position.size()).flip().count();
+                if (position.isOver()) {
+                    this->_status = GameStatus::GameOver;
+                } else if (action.value >= cells || !position.isLegalMove(BitsetMove(action.value))) {
+                    this->_status = GameStatus::IllegalMove;
+                } else {
+                    this->_positions.emplace_back(position.successor(BitsetMove(action.value)));
+                    this->_redoPositions.clear();
+                    this->_status = GameStatus::Ok;
+                }
+                break;
+            }
+            case DifferentialAction::Undo:
+                if (this->_positions.size() > 1) {
+                    this->_redoPositions.emplace_back(this->_positions.back());
+                    this->_positions.pop_back();
+                    this->_status = GameStatus::Ok;
+                } else {
+                    this->_status = GameStatus::NotUndoable;
+                }
+                break;
+            case DifferentialAction::Redo:
+                if (!this->_redoPositions.empty()) {
+                    this->_positions.emplace_back(this->_redoPositions.back());
+                    this->_redoPositions.pop_back();
+                    this->_status = GameStatus::Ok;
+                } else {
+                    this->_status = GameStatus::NotRedoable;
+                }
+                break;
+            case DifferentialAction::Transform:
+                for (auto *positions: {&this->_positions, &this->_redoPositions}) {
+                    for (auto &position: *positions) {
+                        auto transform = (DifferentialTransform) action.value;
+                        position = BitsetPosition(
+                                BitsetPositionBackend::transformed(position.firstBoard(), transform),
+                                BitsetPositionBackend::transformed(position.secondBoard(), transform),
+                                BitsetPositionBackend::transformed(position.neutralBoard(), transform),
+                                position.isFirstTurn()
+                        );
+                    }
+                }
+                this->_status = GameStatus::Ok;
+                break;
+        }
+        return this->_status;
+    }
+
+    DifferentialObservation BitsetPositionBackend::observe() const {
+        const auto &position = this->_positions.back();
+        DifferentialObservation observation = {
+                this->_status,
+                position.size(),
+                position.isFirstTurn(),
+                position.isOver(),
+                position.firstWins(),
+                position.secondWins(),
+                this->_positions.size() > 1,
+                !this->_redoPositions.empty(),
+                (unsigned short) (this->_positions.size() - 1),
+                (unsigned short) position.firstBoard().count(),
+                (unsigned short) position.secondBoard().count(),
+                BitsetPositionBackend::cells(position.firstBoard()),
+                BitsetPositionBackend::cells(position.secondBoard()),
+                BitsetPositionBackend::cells(position.neutralBoard()),
+                BitsetPositionBackend::cells(position.legalBoard()),
+                {},
+                {},
+        };
+        for (unsigned int i = 0; i < DifferentialTransformCount; i++) {
+            auto transform = (DifferentialTransform) i;
+            auto first = BitsetPositionBackend::transformed(position.firstBoard(), transform);
+            auto second = BitsetPositionBackend::transformed(position.secondBoard(), transform);
+            observation.firstSymmetries[i] = BitsetPositionBackend::cells(first);
+            observation.secondSymmetries[i] = BitsetPositionBackend::cells(second);
+        }
+        return observation;
+    }
+
+    BitsetBoard BitsetPositionBackend::transformed(const BitsetBoard &board, DifferentialTransform transform) {
+        switch (transform) {
+            case DifferentialTransform::MirrorHorizontal:
+                return board.mirrorHorizontal();
+            case DifferentialTransform::FlipVertical:
+                return board.flipVertical();
+            case DifferentialTransform::FlipDiagonal:
+                return board.flipDiagonal();
+            case DifferentialTransform::Rotate90:
+                return board.rotate90();
+            case DifferentialTransform::Rotate180:
+                return board.rotate180();
+            case DifferentialTransform::Rotate270:
+                return board.rotate270();
+        }
+        return board;
+    }
+
+    std::string BitsetPositionBackend::cells(const BitsetBoard &board) {
+        std::string cells(BitsetBoard::emptyBoard(board.size()).flip().count(), '0');
+        auto words = board.words();
+        for (unsigned int offset = 0; offset < cells.size(); offset++) {
+            if ((words[offset / 64] >> (offset % 64)) & 1) {
+                cells[offset] = '1';
+            }
+        }
+        return cells;
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef MOSAICGAME_BITSETPOSITIONBACKEND_H
+#define MOSAICGAME_BITSETPOSITIONBACKEND_H
+
+#include <vector>
+#include "DifferentialBackend.h"
+#include "../Game/BitsetPosition.h"
+
+using MosaicGame::Game::BitsetPosition;
+
+namespace MosaicGame::Verification {
+    // Drives BitsetPosition::successor directly, keeping positions on a stack for undo and redo and
+    // transforming them with the board-level symmetry operations.
+    class BitsetPositionBackend : public DifferentialBackend {
+    public:
+        BitsetPositionBackend();
+
+        [[nodiscard]] std::string name() const override;
+
+        [[nodiscard]] unsigned char maxSize() const override;
+
+        void reset(unsigned char size) override;
+
+        GameStatus apply(const DifferentialAction &action) override;
+
+        [[nodiscard]] DifferentialObservation observe() const override;
+
+    private:
+        std::vector<BitsetPosition> _positions;
+        std::vector<BitsetPosition> _redoPositions;
+        GameStatus _status;
+
+        static BitsetBoard transformed(const BitsetBoard &board, DifferentialTransform transform);
+
+        static std::string cells(const BitsetBoard &board);
+    };
+}
+
+#endif //MOSAICGAME_BITSETPOSITIONBACKEND_H
@@ -0,0 +1,72 @@
+#include "DifferentialBackend.h"
+
+#include <stdexcept>
+
+namespace MosaicGame::Verification {
+
+    std::string DifferentialAction::toString() const {
+        switch (this->kind) {
+            case DifferentialAction::Move:
+                return "m" + std::to_string(this->value);
+            case DifferentialAction::Undo:
+                return "u";
+            case DifferentialAction::Redo:
+                return "r";
+            case DifferentialAction::Transform:
+                return "t" + std::to_string(this->value);
+        }
+        return "?";
+    }
+
+    DifferentialAction DifferentialAction::fromString(const std::string &text) {
+        if (text == "u") {
+            return {DifferentialAction::Undo, 0};
+        }
+        if (text == "r") {
+            return {DifferentialAction::Redo, 0};
+        }
+        if (text.size() > 1 && (text[0] == 'm' || text[0] == 't')) {
+            auto value = (unsigned int) std::stoul(text.substr(1));
+            if (text[0] == 'm') {
+                return {DifferentialAction::Move, value};
+            }
+            if (value < DifferentialTransformCount) {
+                return {DifferentialAction::Transform, value};
+            }
+        }
+        throw std::runtime_error("Invalid action: " + text + ".");
+    }
+
+    std::vector<std::string> DifferentialObservation::differences(const DifferentialObservation &other) const {
+        std::vector<std::string> differences = {};
+        auto compare = [&differences](const std::string &name, const auto &expected, const auto &actual) {
+            if (expected != actual) {
+                differences.emplace_back(name + " " + expected + " vs " + actual);
+            }
+        };
+        auto number = [](auto value) {
+            return std::to_string((unsigned int) value);
+        };
+
+        compare("status", number(this->status), number(other.status));
+        compare("size", number(this->size), number(other.size));
+        compare("firstTurn", number(this->firstTurn), number(other.firstTurn));
+        compare("over", number(this->over), number(other.over));
+        compare("firstWins", number(this->firstWins), number(other.firstWins));
+        compare("secondWins", number(this->secondWins), number(other.secondWins));
+        compare("undoable", number(this->undoable), number(other.undoable));
+        compare("redoable", number(this->redoable), number(other.redoable));
+        compare("movesMade", number(this->movesMade), number(other.movesMade));
+        compare("firstScore", number(this->firstScore), number(other.firstScore));
+        compare("secondScore", number(this->secondScore), number(other.secondScore));
+        compare("firstBoard", this->firstBoard, other.firstBoard);
+        compare("secondBoard", this->secondBoard, other.secondBoard);
+        compare("neutralBoard", this->neutralBoard, other.neutralBoard);
+        compare("legalBoard", this->legalBoard, other.legalBoard);
+        for (unsigned int i = 0; i < DifferentialTransformCount; i++) {
+            compare("firstSymmetries[" + std::to_string(i) + "]", this->firstSymmetries[i], other.firstSymmetries[i]);
+            compare("secondSymmetries[" + std::to_string(i) + "]", this->secondSymmetries[i], other.secondSymmetries[i]);
+        }
+        return differences;
+    }
+}
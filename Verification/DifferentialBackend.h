@@ -0,0 +1,197 @@
+#ifndef MOSAICGAME_DIFFERENTIALBACKEND_H
+#define MOSAICGAME_DIFFERENTIALBACKEND_H
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../Game/OneToOneGame.h"
+
+using MosaicGame::Game::GameStatus;
+
+namespace MosaicGame::Verification {
+    enum class DifferentialTransform : unsigned char {
+        MirrorHorizontal = 0,
+        FlipVertical = 1,
+        FlipDiagonal = 2,
+        Rotate90 = 3,
+        Rotate180 = 4,
+        Rotate270 = 5,
+    };
+
+    constexpr unsigned int DifferentialTransformCount = 6;
+
+    struct DifferentialAction {
+        enum Kind : unsigned char {
+            Move = 0,
+            Undo = 1,
+            Redo = 2,
+            Transform = 3,
+        };
+
+        Kind kind;
+        // The offset of a Move or the DifferentialTransform of a Transform.
+        unsigned int value;
+
+        // "m12", "u", "r" or "t3".
+        [[nodiscard]] std::string toString() const;
+
+        static DifferentialAction fromString(const std::string &text);
+    };
+
+    // Everything a backend exposes after an action. Boards are written one character per cell in offset
+    // order, so backends with different internal layouts compare as plain strings.
+    struct DifferentialObservation {
+        GameStatus status;
+        unsigned char size;
+        bool firstTurn;
+        bool over;
+        bool firstWins;
+        bool secondWins;
+        bool undoable;
+        bool redoable;
+        unsigned short movesMade;
+        unsigned short firstScore;
+        unsigned short secondScore;
+        std::string firstBoard;
+        std::string secondBoard;
+        std::string neutralBoard;
+        std::string legalBoard;
+        // The first and second boards under every DifferentialTransform.
+        std::array<std::string, DifferentialTransformCount> firstSymmetries;
+        std::array<std::string, DifferentialTransformCount> secondSymmetries;
+
+        [[nodiscard]] bool operator==(const DifferentialObservation &other) const = default;
+
+        // Names of the fields that differ from other, with their values on both sides.
+        [[nodiscard]] std::vector<std::string> differences(const DifferentialObservation &other) const;
+    };
+
+    // One implementation of the rules driven in lockstep with the others.
+    class DifferentialBackend {
+    public:
+        virtual ~DifferentialBackend() = default;
+
+        [[nodiscard]] virtual std::string name() const = 0;
+
+        [[nodiscard]] virtual unsigned char maxSize() const = 0;
+
+        virtual void reset(unsigned char size) = 0;
+
+        virtual GameStatus apply(const DifferentialAction &action) = 0;
+
+        [[nodiscard]] virtual DifferentialObservation observe() const = 0;
+    };
+
+    // Adapts any OneToOneGame.
+    template<Game::OneToOneGame GAME>
+    class OneToOneGameBackend : public DifferentialBackend {
+    public:
+        explicit OneToOneGameBackend(std::string name, unsigned char maxSize) :
+                _name(std::move(name)),
+                _maxSize(maxSize),
+                _status(GameStatus::Ok) {}
+
+        [[nodiscard]] std::string name() const override {
+            return this->_name;
+        }
+
+        [[nodiscard]] unsigned char maxSize() const override {
+            return this->_maxSize;
+        }
+
+        void reset(unsigned char size) override {
+            this->_game = std::make_unique<GAME>(size);
+            this->_status = GameStatus::Ok;
+        }
+
+        GameStatus apply(const DifferentialAction &action) override {
+            auto &game = *this->_game;
+            switch (action.kind) {
+                case DifferentialAction::Move:
+                    this->_status = game.tryMakeMove(typename GAME::MoveType(action.value));
+                    break;
+                case DifferentialAction::Undo:
+                    this->_status = game.tryUndo();
+                    break;
+                case DifferentialAction::Redo:
+                    this->_status = game.tryRedo();
+                    break;
+                case DifferentialAction::Transform:
+                    this->_status = GameStatus::Ok;
+                    switch ((DifferentialTransform) action.value) {
+                        case DifferentialTransform::MirrorHorizontal:
+                            game.mirrorHorizontal();
+                            break;
+                        case DifferentialTransform::FlipVertical:
+                            game.flipVertical();
+                            break;
+                        case DifferentialTransform::FlipDiagonal:
+                            game.flipDiagonal();
+                            break;
+                        case DifferentialTransform::Rotate90:
+                            game.rotate90();
+                            break;
+                        case DifferentialTransform::Rotate180:
+                            game.rotate180();
+                            break;
+                        case DifferentialTransform::Rotate270:
+                            game.rotate270();
+                            break;
+                    }
+                    break;
+            }
+            return this->_status;
+        }
+
+        [[nodiscard]] DifferentialObservation observe() const override {
+            const auto &game = *this->_game;
+            DifferentialObservation observation = {
+                    this->_status,
+                    game.size(),
+                    game.isFirstTurn(),
+                    game.isOver(),
+                    game.firstWins(),
+                    game.secondWins(),
+                    game.isUndoable(),
+                    game.isRedoable(),
+                    game.movesMade(),
+                    game.firstScore(),
+                    game.secondScore(),
+                    cells(game.firstBoard()),
+                    cells(game.secondBoard()),
+                    cells(game.neutralBoard()),
+                    cells(game.legalBoard()),
+                    {},
+                    {},
+            };
+            auto first = game.firstBoard();
+            auto second = game.secondBoard();
+            observation.firstSymmetries = {
+                    cells(first.mirrorHorizontal()), cells(first.flipVertical()), cells(first.flipDiagonal()),
+                    cells(first.rotate90()), cells(first.rotate180()), cells(first.rotate270()),
+            };
+            observation.secondSymmetries = {
+                    cells(second.mirrorHorizontal()), cells(second.flipVertical()), cells(second.flipDiagonal()),
+                    cells(second.rotate90()), cells(second.rotate180()), cells(second.rotate270()),
+            };
+            return observation;
+        }
+
+    private:
+        std::string _name;
+        unsigned char _maxSize;
+        std::unique_ptr<GAME> _game;
+        GameStatus _status;
+
+        // toString() puts the highest offset first.
+        static std::string cells(const typename GAME::BoardType &board) {
+            auto string = board.toString();
+            std::reverse(string.begin(), string.end());
+            return string;
+        }
+    };
+}
+
+#endif //MOSAICGAME_DIFFERENTIALBACKEND_H
@@ -0,0 +1,200 @@
+#include "DifferentialTester.h"
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include "../Instrumentation/Tracer.h"
+#include "../SelfPlay/WorkStealingPool.h"
+
+using MosaicGame::SelfPlay::WorkStealingPool;
+
+namespace MosaicGame::Verification {
+
+    DifferentialTester::DifferentialTester(std::vector<BackendFactory> factories) : _factories(std::move(factories)) {
+        if (this->_factories.size() < 2) {
+            throw std::runtime_error("At least two backends are needed.");
+        }
+    }
+
+    DifferentialResult DifferentialTester::run(const DifferentialConfiguration &configuration) const {
+        if (configuration.minSize < 1 || configuration.minSize > configuration.maxSize) {
+            throw std::runtime_error("The size range is invalid.");
+        }
+
+        auto pool = WorkStealingPool(configuration.threads);
+        std::vector<std::vector<std::unique_ptr<DifferentialBackend>>> workerBackends(pool.threads());
+        std::atomic<std::uint64_t> actionCount = 0;
+        std::atomic<std::uint64_t> failingGame = std::numeric_limits<std::uint64_t>::max();
+        std::optional<DifferentialFailure> failure;
+        std::mutex failureMutex;
+
+        pool.run(configuration.games, [&](std::size_t game, unsigned int worker) {
+            if (game > failingGame.load()) {
+                return;
+            }
+            MOSAICGAME_TRACE_SPAN("game", "differential");
+            auto &backends = workerBackends[worker];
+            if (backends.empty()) {
+                backends = this->createBackends();
+            }
+            auto random = std::mt19937_64(configuration.seed + game);
+            auto sizes = configuration.maxSize - configuration.minSize + 1;
+            auto size = (unsigned char) (configuration.minSize + random() % sizes);
+            std::vector<DifferentialAction> actions = {};
+            auto divergence = DifferentialTester::play(backends, size, random, actions);
+            actionCount += actions.size();
+            if (divergence.has_value()) {
+                divergence->game = game;
+                std::lock_guard<std::mutex> lock(failureMutex);
+                if (game < failingGame.load()) {
+                    failingGame = game;
+                    failure = std::move(divergence);
+                }
+            }
+        });
+
+        DifferentialResult result = {configuration.games, actionCount.load(), std::nullopt};
+        if (failure.has_value()) {
+            result.games = failure->game + 1;
+            result.failure = this->shrink(*failure);
+        }
+        return result;
+    }
+
+    std::optional<DifferentialFailure> DifferentialTester::check(unsigned char size,
+                                                                 const std::vector<DifferentialAction> &actions) const {
+        auto backends = this->createBackends();
+        DifferentialObservation observation = {};
+        for (auto &backend: backends) {
+            if (size <= backend->maxSize()) {
+                backend->reset(size);
+            }
+        }
+        auto divergence = DifferentialTester::step(backends, size, std::nullopt, observation);
+        for (std::size_t i = 0; i < actions.size() && !divergence.has_value(); i++) {
+            divergence = DifferentialTester::step(backends, size, actions[i], observation);
+            if (divergence.has_value()) {
+                divergence->actions.assign(actions.begin(), actions.begin() + i + 1);
+                divergence->step = i + 1;
+            }
+        }
+        return divergence;
+    }
+
+    DifferentialFailure DifferentialTester::shrink(const DifferentialFailure &failure) const {
+        auto best = failure;
+        std::size_t chunk = std::max<std::size_t>(best.actions.size() / 2, 1);
+        while (!best.actions.empty()) {
+            auto removed = false;
+            for (std::size_t start = 0; start < best.actions.size();) {
+                auto candidate = best.actions;
+                auto end = std::min(start + chunk, candidate.size());
+                candidate.erase(candidate.begin() + start, candidate.begin() + end);
+                auto divergence = this->check(best.size, candidate);
+                if (divergence.has_value()) {
+                    divergence->game = best.game;
+                    best = std::move(*divergence);
+                    removed = true;
+                } else {
+                    start += chunk;
+                }
+            }
+            if (!removed) {
+                if (chunk == 1) {
+                    break;
+                }
+                chunk /= 2;
+            }
+        }
+        return best;
+    }
+
+    std::vector<std::unique_ptr<DifferentialBackend>> DifferentialTester::createBackends() const {
+        std::vector<std::unique_ptr<DifferentialBackend>> backends = {};
+        for (const auto &factory: this->_factories) {
+            backends.emplace_back(factory());
+        }
+        return backends;
+    }
+
+    std::optional<DifferentialFailure> DifferentialTester::play(
+            std::vector<std::unique_ptr<DifferentialBackend>> &backends, unsigned char size, std::mt19937_64 &random,
+            std::vector<DifferentialAction> &actions) {
+        for (auto &backend: backends) {
+            if (size <= backend->maxSize()) {
+                backend->reset(size);
+            }
+        }
+        DifferentialObservation observation = {};
+        auto divergence = DifferentialTester::step(backends, size, std::nullopt, observation);
+
+        // Undo and redo can keep a game going for a while, so it is cut off well past any natural length.
+        const auto limit = 4 * observation.legalBoard.size() + 16;
+        while (!divergence.has_value() && actions.size() < limit) {
+            auto over = observation.over;
+            // A finished game gets one more move to check that it is refused.
+            actions.emplace_back(DifferentialTester::randomAction(observation, random));
+            divergence = DifferentialTester::step(backends, size, actions.back(), observation);
+            if (over) {
+                break;
+            }
+        }
+        if (divergence.has_value()) {
+            divergence->actions = actions;
+            divergence->step = actions.size();
+        }
+        return divergence;
+    }
+
+    DifferentialAction DifferentialTester::randomAction(const DifferentialObservation &observation,
+                                                        std::mt19937_64 &random) {
+        std::vector<unsigned int> legalOffsets = {};
+        for (unsigned int offset = 0; offset < observation.legalBoard.size(); offset++) {
+            if (observation.legalBoard[offset] == '1') {
+                legalOffsets.emplace_back(offset);
+            }
+        }
+
+        auto roll = random() % 64;
+        if (roll < 4 && observation.undoable && !observation.over) {
+            return {DifferentialAction::Undo, 0};
+        }
+        if (roll < 6 && observation.redoable && !observation.over) {
+            return {DifferentialAction::Redo, 0};
+        }
+        if (roll < 8 && !observation.over) {
+            return {DifferentialAction::Transform, (unsigned int) (random() % DifferentialTransformCount)};
+        }
+        if (roll < 9 || legalOffsets.empty()) {
+            // Mostly occupied or unsupported cells, sometimes past the end of the board.
+            return {DifferentialAction::Move, (unsigned int) (random() % (observation.legalBoard.size() + 8))};
+        }
+        return {DifferentialAction::Move, legalOffsets[random() % legalOffsets.size()]};
+    }
+
+    std::optional<DifferentialFailure> DifferentialTester::step(
+            std::vector<std::unique_ptr<DifferentialBackend>> &backends, unsigned char size,
+            const std::optional<DifferentialAction> &action, DifferentialObservation &observation) {
+        for (std::size_t i = 0; i < backends.size(); i++) {
+            auto &backend = *backends[i];
+            if (size > backend.maxSize()) {
+                continue;
+            }
+            try {
+                if (action.has_value()) {
+                    backend.apply(*action);
+                }
+                auto current = backend.observe();
+                if (i == 0) {
+                    observation = std::move(current);
+                } else if (current != observation) {
+                    return DifferentialFailure{0, size, {}, 0, backend.name(), observation.differences(current)};
+                }
+            } catch (const std::exception &exception) {
+                return DifferentialFailure{0, size, {}, 0, backend.name(), {std::string("threw ") + exception.what()}};
+            }
+        }
+        return std::nullopt;
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef MOSAICGAME_DIFFERENTIALTESTER_H
+#define MOSAICGAME_DIFFERENTIALTESTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+#include "DifferentialBackend.h"
+
+namespace MosaicGame::Verification {
+    struct DifferentialConfiguration {
+        std::uint64_t games = 10000;
+        unsigned int threads = 0;
+        std::uint64_t seed = 0;
+        unsigned char minSize = 1;
+        unsigned char maxSize = 7;
+    };
+
+    struct DifferentialFailure {
+        std::uint64_t game;
+        unsigned char size;
+        std::vector<DifferentialAction> actions;
+        // Actions applied when the backends disagreed; zero for the initial position.
+        std::size_t step;
+        std::string backend;
+        std::vector<std::string> differences;
+    };
+
+    struct DifferentialResult {
+        std::uint64_t games;
+        std::uint64_t actions;
+        // The first failing game, shrunk.
+        std::optional<DifferentialFailure> failure;
+    };
+
+    // Plays random games in lockstep across several rule implementations and compares everything they
+    // expose after each action. The first backend is the oracle: it picks the random legal moves and the
+    // others are checked against it. Failures are shrunk to a short action sequence that still diverges.
+    class DifferentialTester {
+    public:
+        using BackendFactory = std::function<std::unique_ptr<DifferentialBackend>()>;
+
+        explicit DifferentialTester(std::vector<BackendFactory> factories);
+
+        [[nodiscard]] DifferentialResult run(const DifferentialConfiguration &configuration) const;
+
+        // Replays a fixed sequence and reports the first divergence.
+        [[nodiscard]] std::optional<DifferentialFailure> check(unsigned char size,
+                                                               const std::vector<DifferentialAction> &actions) const;
+
+        // Removes actions while the sequence keeps diverging.
+        [[nodiscard]] DifferentialFailure shrink(const DifferentialFailure &failure) const;
+
+    private:
+        std::vector<BackendFactory> _factories;
+
+        [[nodiscard]] std::vector<std::unique_ptr<DifferentialBackend>> createBackends() const;
+
+        // Plays one random game, appending the actions taken. Returns the divergence if any.
+        static std::optional<DifferentialFailure> play(std::vector<std::unique_ptr<DifferentialBackend>> &backends,
+                                                       unsigned char size, std::mt19937_64 &random,
+                                                       std::vector<DifferentialAction> &actions);
+
+        [[nodiscard]] static DifferentialAction randomAction(const DifferentialObservation &observation,
+                                                             std::mt19937_64 &random);
+
+        // Applies the action everywhere, if any, and compares each backend with the oracle, whose observation
+        // is stored.
+        static std::optional<DifferentialFailure> step(std::vector<std::unique_ptr<DifferentialBackend>> &backends,
+                                                       unsigned char size,
+                                                       const std::optional<DifferentialAction> &action,
+                                                       DifferentialObservation &observation);
+    };
+}
+
+#endif //MOSAICGAME_DIFFERENTIALTESTER_H
@@ -0,0 +1,264 @@
+#include "ReferenceBackend.h"
+
+#include <stdexcept>
+
+namespace MosaicGame::Verification {
+
+    ReferenceBackend::ReferenceBackend() : _size(0), _cellCount(0), _piecesPerPlayer(0), _status(GameStatus::Ok) {}
+
+    std::string ReferenceBackend::name() const {
+        return "reference";
+    }
+
+    unsigned char ReferenceBackend::maxSize() const {
+        return ReferenceBackend::MaxSize;
+    }
+
+    void ReferenceBackend::reset(unsigned char size) {
+        if (size < 1 || size > ReferenceBackend::MaxSize) {
+            throw std::runtime_error("The size is not supported.");
+        }
+        this->_size = size;
+        this->_cellCount = ReferenceBackend::layerShift(size + 1);
+        this->_piecesPerPlayer = this->_cellCount / 2;
+        State state = {std::vector<unsigned char>(this->_cellCount, Empty), true};
+        if (size % 2 == 1) {
+            state.cells[ReferenceBackend::layerShift(size) + size * size / 2] = Neutral;
+        }
+        this->_states = {state};
+        this->_redoStates.clear();
+        this->_status = GameStatus::Ok;
+    }
+
+    GameStatus ReferenceBackend::apply(const DifferentialAction &action) {
+        switch (action.kind) {
+            case DifferentialAction::Move: {
+                const auto &state = this->current();
+                if (this->isOver(state)) {
+                    this->_status = GameStatus::GameOver;
+                } else if (action.value >= this->_cellCount || !this->isLegal(state, action.value)) {
+                    this->_status = GameStatus::IllegalMove;
+                } else {
+                    auto next = state;
+                    this->place(next, action.value);
+                    this->_states.emplace_back(std::move(next));
+                    this->_redoStates.clear();
+                    this->_status = GameStatus::Ok;
+                }
+                break;
+            }
+            case DifferentialAction::Undo:
+                if (this->_states.size() > 1) {
+                    this->_redoStates.emplace_back(std::move(this->_states.back()));
+                    this->_states.pop_back();
+                    this->_status = GameStatus::Ok;
+                } else {
+                    this->_status = GameStatus::NotUndoable;
+                }
+                break;
+            case DifferentialAction::Redo:
+                if (!this->_redoStates.empty()) {
+                    this->_states.emplace_back(std::move(this->_redoStates.back()));
+                    this->_redoStates.pop_back();
+                    this->_status = GameStatus::Ok;
+                } else {
+                    this->_status = GameStatus::NotRedoable;
+                }
+                break;
+            case DifferentialAction::Transform:
+                for (auto *states: {&this->_states, &this->_redoStates}) {
+                    for (auto &state: *states) {
+                        state.cells = this->transformed(state.cells, (DifferentialTransform) action.value);
+                    }
+                }
+                this->_status = GameStatus::Ok;
+                break;
+        }
+        return this->_status;
+    }
+
+    DifferentialObservation ReferenceBackend::observe() const {
+        const auto &state = this->current();
+        std::string legalBoard(this->_cellCount, '0');
+        for (unsigned int offset = 0; offset < this->_cellCount; offset++) {
+            if (this->isLegal(state, offset)) {
+                legalBoard[offset] = '1';
+            }
+        }
+        auto firstScore = this->score(state, First);
+        auto secondScore = this->score(state, Second);
+        DifferentialObservation observation = {
+                this->_status,
+                this->_size,
+                state.firstTurn,
+                this->isOver(state),
+                firstScore >= this->_piecesPerPlayer,
+                secondScore >= this->_piecesPerPlayer,
+                this->_states.size() > 1,
+                !this->_redoStates.empty(),
+                (unsigned short) (this->_states.size() - 1),
+                firstScore,
+                secondScore,
+                this->board(state.cells, First),
+                this->board(state.cells, Second),
+                this->board(state.cells, Neutral),
+                legalBoard,
+                {},
+                {},
+        };
+        for (unsigned int i = 0; i < DifferentialTransformCount; i++) {
+            auto cells = this->transformed(state.cells, (DifferentialTransform) i);
+            observation.firstSymmetries[i] = this->board(cells, First);
+            observation.secondSymmetries[i] = this->board(cells, Second);
+        }
+        return observation;
+    }
+
+    const ReferenceBackend::State &ReferenceBackend::current() const {
+        return this->_states.back();
+    }
+
+    unsigned short ReferenceBackend::score(const State &state, Cell owner) const {
+        unsigned short score = 0;
+        for (auto cell: state.cells) {
+            score += cell == owner;
+        }
+        return score;
+    }
+
+    bool ReferenceBackend::isOver(const State &state) const {
+        return this->score(state, First) >= this->_piecesPerPlayer
+               || this->score(state, Second) >= this->_piecesPerPlayer;
+    }
+
+    bool ReferenceBackend::isLegal(const State &state, unsigned int offset) const {
+        if (state.cells[offset] != Empty) {
+            return false;
+        }
+        for (auto support: this->supports(offset)) {
+            if (state.cells[support] == Empty) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ReferenceBackend::hasMajority(const State &state, unsigned int offset, Cell owner) const {
+        auto supports = this->supports(offset);
+        auto owned = 0;
+        for (auto support: supports) {
+            owned += state.cells[support] == owner;
+        }
+        return !supports.empty() && owned >= 3;
+    }
+
+    std::vector<unsigned int> ReferenceBackend::supports(unsigned int offset) const {
+        unsigned int layerSize = 1;
+        while (offset >= ReferenceBackend::layerShift(layerSize + 1)) {
+            layerSize++;
+        }
+        if (layerSize == this->_size) {
+            return {};
+        }
+        auto index = offset - ReferenceBackend::layerShift(layerSize);
+        auto row = index / layerSize;
+        auto column = index % layerSize;
+        auto below = layerSize + 1;
+        auto base = ReferenceBackend::layerShift(below);
+        return {
+                base + row * below + column,
+                base + row * below + column + 1,
+                base + (row + 1) * below + column,
+                base + (row + 1) * below + column + 1,
+        };
+    }
+
+    // Places the piece, then lets each side in turn fill every legal cell it holds a majority under. When
+    // a side has fewer pieces left than such cells, the lowest offsets are filled first.
+    void ReferenceBackend::place(State &state, unsigned int offset) const {
+        state.cells[offset] = state.firstTurn ? First : Second;
+        while (true) {
+            auto chained = false;
+            for (auto owner: {First, Second}) {
+                std::vector<unsigned int> chain = {};
+                for (unsigned int cell = 0; cell < this->_cellCount; cell++) {
+                    if (this->isLegal(state, cell) && this->hasMajority(state, cell, owner)) {
+                        chain.emplace_back(cell);
+                    }
+                }
+                if (chain.empty()) {
+                    continue;
+                }
+                auto vacancy = (unsigned int) (this->_piecesPerPlayer - this->score(state, owner));
+                for (unsigned int i = 0; i < chain.size() && i < vacancy; i++) {
+                    state.cells[chain[i]] = owner;
+                }
+                chained = true;
+            }
+            if (!chained || this->isOver(state)) {
+                break;
+            }
+        }
+        state.firstTurn = !state.firstTurn;
+    }
+
+    std::vector<unsigned char> ReferenceBackend::transformed(const std::vector<unsigned char> &cells,
+                                                             DifferentialTransform transform) const {
+        auto result = cells;
+        for (unsigned int layerSize = 1; layerSize <= this->_size; layerSize++) {
+            auto base = ReferenceBackend::layerShift(layerSize);
+            auto last = layerSize - 1;
+            for (unsigned int row = 0; row < layerSize; row++) {
+                for (unsigned int column = 0; column < layerSize; column++) {
+                    unsigned int targetRow = row;
+                    unsigned int targetColumn = column;
+                    switch (transform) {
+                        case DifferentialTransform::MirrorHorizontal:
+                            targetColumn = last - column;
+                            break;
+                        case DifferentialTransform::FlipVertical:
+                            targetRow = last - row;
+                            break;
+                        case DifferentialTransform::FlipDiagonal:
+                            // Reflects across the anti-diagonal.
+                            targetRow = last - column;
+                            targetColumn = last - row;
+                            break;
+                        case DifferentialTransform::Rotate90:
+                            targetRow = column;
+                            targetColumn = last - row;
+                            break;
+                        case DifferentialTransform::Rotate180:
+                            targetRow = last - row;
+                            targetColumn = last - column;
+                            break;
+                        case DifferentialTransform::Rotate270:
+                            targetRow = last - column;
+                            targetColumn = row;
+                            break;
+                    }
+                    result[base + targetRow * layerSize + targetColumn] = cells[base + row * layerSize + column];
+                }
+            }
+        }
+        return result;
+    }
+
+    std::string ReferenceBackend::board(const std::vector<unsigned char> &cells, Cell owner) const {
+        std::string board(cells.size(), '0');
+        for (std::size_t offset = 0; offset < cells.size(); offset++) {
+            if (cells[offset] == owner) {
+                board[offset] = '1';
+            }
+        }
+        return board;
+    }
+
+    unsigned int ReferenceBackend::layerShift(unsigned int layerSize) {
+        unsigned int layerShift = 0;
+        for (unsigned int i = 0; i < layerSize; i++) {
+            layerShift += i * i;
+        }
+        return layerShift;
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef MOSAICGAME_REFERENCEBACKEND_H
+#define MOSAICGAME_REFERENCEBACKEND_H
+
+#include <vector>
+#include "DifferentialBackend.h"
+
+namespace MosaicGame::Verification {
+    // The rules written out cell by cell with no bit tricks, used as the oracle the other backends are
+    // compared against. Undo and redo keep whole states, and transforms rewrite every stored state.
+    class ReferenceBackend : public DifferentialBackend {
+    public:
+        static constexpr unsigned char MaxSize = 32;
+
+        ReferenceBackend();
+
+        [[nodiscard]] std::string name() const override;
+
+        [[nodiscard]] unsigned char maxSize() const override;
+
+        void reset(unsigned char size) override;
+
+        GameStatus apply(const DifferentialAction &action) override;
+
+        [[nodiscard]] DifferentialObservation observe() const override;
+
+    private:
+        enum Cell : unsigned char {
+            Empty = 0,
+            First = 1,
+            Second = 2,
+            Neutral = 3,
+        };
+
+        struct State {
+            std::vector<unsigned char> cells;
+            bool firstTurn;
+        };
+
+        unsigned char _size;
+        unsigned int _cellCount;
+        unsigned short _piecesPerPlayer;
+        std::vector<State> _states;
+        std::vector<State> _redoStates;
+        GameStatus _status;
+
+        [[nodiscard]] const State &current() const;
+
+        [[nodiscard]] unsigned short score(const State &state, Cell owner) const;
+
+        [[nodiscard]] bool isOver(const State &state) const;
+
+        [[nodiscard]] bool isLegal(const State &state, unsigned int offset) const;
+
+        [[nodiscard]] bool hasMajority(const State &state, unsigned int offset, Cell owner) const;
+
+        [[nodiscard]] std::vector<unsigned int> supports(unsigned int offset) const;
+
+        void place(State &state, unsigned int offset) const;
+
+        [[nodiscard]] std::vector<unsigned char> transformed(const std::vector<unsigned char> &cells,
+                                                             DifferentialTransform transform) const;
+
+        [[nodiscard]] std::string board(const std::vector<unsigned char> &cells, Cell owner) const;
+
+        static unsigned int layerShift(unsigned int layerSize);
+    };
+}
+
+#endif //MOSAICGAME_REFERENCEBACKEND_H
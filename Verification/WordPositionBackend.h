@@ -0,0 +1,155 @@
+#ifndef MOSAICGAME_WORDPOSITIONBACKEND_H
+#define MOSAICGAME_WORDPOSITIONBACKEND_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "DifferentialBackend.h"
+#include "../Game/WordPosition.h"
+
+using MosaicGame::Game::WordPosition;
+
+namespace MosaicGame::Verification {
+    // Drives WordPosition::successor the way BitsetPositionBackend drives BitsetPosition, so the word board
+    // is checked on every size its word count allows.
+    template<unsigned int WORDS>
+    class WordPositionBackend : public DifferentialBackend {
+    public:
+        using Position = WordPosition<WORDS>;
+        using BoardType = typename Position::BoardType;
+
+        explicit WordPositionBackend(std::string name) : _name(std::move(name)), _status(GameStatus::Ok) {}
+
+        [[nodiscard]] std::string name() const override {
+            return this->_name;
+        }
+
+        [[nodiscard]] unsigned char maxSize() const override {
+            return BoardType::MaxSize;
+        }
+
+        void reset(unsigned char size) override {
+            this->_positions = {Position(size)};
+            this->_redoPositions.clear();
+            this->_status = GameStatus::Ok;
+        }
+
+        GameStatus apply(const DifferentialAction &action) override {
+            switch (action.kind) {
+                case DifferentialAction::Move: {
+                    const auto &position = this->_positions.back();
+                    if (position.isOver()) {
+                        this->_status = GameStatus::GameOver;
+                    } else if (!position.isLegalMove(action.value)) {
+                        this->_status = GameStatus::IllegalMove;
+                    } else {
+                        this->_positions.emplace_back(position.successor(action.value));
+                        this->_redoPositions.clear();
+                        this->_status = GameStatus::Ok;
+                    }
+                    break;
+                }
+                case DifferentialAction::Undo:
+                    if (this->_positions.size() > 1) {
+                        this->_redoPositions.emplace_back(this->_positions.back());
+                        this->_positions.pop_back();
+                        this->_status = GameStatus::Ok;
+                    } else {
+                        this->_status = GameStatus::NotUndoable;
+                    }
+                    break;
+                case DifferentialAction::Redo:
+                    if (!this->_redoPositions.empty()) {
+                        this->_positions.emplace_back(this->_redoPositions.back());
+                        this->_redoPositions.pop_back();
+                        this->_status = GameStatus::Ok;
+                    } else {
+                        this->_status = GameStatus::NotRedoable;
+                    }
+                    break;
+                case DifferentialAction::Transform:
+                    for (auto *positions: {&this->_positions, &this->_redoPositions}) {
+                        for (auto &position: *positions) {
+                            auto transform = (DifferentialTransform) action.value;
+                            position = Position(
+                                    WordPositionBackend::transformed(position.firstBoard(), transform),
+                                    WordPositionBackend::transformed(position.secondBoard(), transform),
+                                    WordPositionBackend::transformed(position.neutralBoard(), transform),
+                                    position.isFirstTurn()
+                            );
+                        }
+                    }
+                    this->_status = GameStatus::Ok;
+                    break;
+            }
+            return this->_status;
+        }
+
+        [[nodiscard]] DifferentialObservation observe() const override {
+            const auto &position = this->_positions.back();
+            DifferentialObservation observation = {
+                    this->_status,
+                    position.size(),
+                    position.isFirstTurn(),
+                    position.isOver(),
+                    position.firstWins(),
+                    position.secondWins(),
+                    this->_positions.size() > 1,
+                    !this->_redoPositions.empty(),
+                    (unsigned short) (this->_positions.size() - 1),
+                    (unsigned short) position.firstBoard().count(),
+                    (unsigned short) position.secondBoard().count(),
+                    WordPositionBackend::cells(position.firstBoard()),
+                    WordPositionBackend::cells(position.secondBoard()),
+                    WordPositionBackend::cells(position.neutralBoard()),
+                    WordPositionBackend::cells(position.legalBoard()),
+                    {},
+                    {},
+            };
+            for (unsigned int i = 0; i < DifferentialTransformCount; i++) {
+                auto transform = (DifferentialTransform) i;
+                auto first = WordPositionBackend::transformed(position.firstBoard(), transform);
+                auto second = WordPositionBackend::transformed(position.secondBoard(), transform);
+                observation.firstSymmetries[i] = WordPositionBackend::cells(first);
+                observation.secondSymmetries[i] = WordPositionBackend::cells(second);
+            }
+            return observation;
+        }
+
+    private:
+        std::string _name;
+        std::vector<Position> _positions;
+        std::vector<Position> _redoPositions;
+        GameStatus _status;
+
+        static BoardType transformed(const BoardType &board, DifferentialTransform transform) {
+            switch (transform) {
+                case DifferentialTransform::MirrorHorizontal:
+                    return board.mirrorHorizontal();
+                case DifferentialTransform::FlipVertical:
+                    return board.flipVertical();
+                case DifferentialTransform::FlipDiagonal:
+                    return board.flipDiagonal();
+                case DifferentialTransform::Rotate90:
+                    return board.rotate90();
+                case DifferentialTransform::Rotate180:
+                    return board.rotate180();
+                case DifferentialTransform::Rotate270:
+                    return board.rotate270();
+            }
+            return board;
+        }
+
+        static std::string cells(const BoardType &board) {
+            std::string cells(Board::pyramidCells(board.size()), '0');
+            for (unsigned int offset = 0; offset < cells.size(); offset++) {
+                if (board.test(offset)) {
+                    cells[offset] = '1';
+                }
+            }
+            return cells;
+        }
+    };
+}
+
+#endif //MOSAICGAME_WORDPOSITIONBACKEND_H
@@ -0,0 +1,200 @@
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <execinfo.h>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "library.h"
+#include "Engine/BitsetMonteCarloEngine.h"
+#include "Game/BitsetOneToOneGame.h"
+#include "Game/BitsetPosition.h"
+
+using MosaicGame::Engine::BitsetMonteCarloEngine;
+using MosaicGame::Game::BitsetOneToOneGame;
+using MosaicGame::Game::BitsetPosition;
+
+// Replaces the global allocation functions to prove that steady-state hot paths never touch the heap.
+// Each scenario runs a few warmup rounds (filling caches, pools and arenas), then repeats with counting
+// enabled; any allocation fails the scenario and the distinct allocating call stacks are printed.
+namespace {
+    constexpr std::size_t MaximumSites = 8;
+    constexpr int MaximumFrames = 24;
+
+    struct Site {
+        void *frames[MaximumFrames];
+        int depth;
+        std::size_t count;
+    };
+
+    std::atomic<bool> counting = false;
+    std::atomic<std::size_t> allocations = 0;
+    Site sites[MaximumSites];
+    std::size_t siteCount = 0;
+    thread_local bool inHook = false;
+
+    void recordAllocation() {
+        if (!counting.load(std::memory_order_relaxed) || inHook) {
+            return;
+        }
+        inHook = true;
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        Site site = {};
+        site.depth = backtrace(site.frames, MaximumFrames);
+        auto known = false;
+        for (std::size_t i = 0; i < siteCount && !known; i++) {
+            if (sites[i].depth == site.depth &&
+                std::memcmp(sites[i].frames, site.frames, sizeof(void *) * site.depth) == 0) {
+                sites[i].count++;
+                known = true;
+            }
+        }
+        if (!known && siteCount < MaximumSites) {
+            site.count = 1;
+            sites[siteCount++] = site;
+        }
+        inHook = false;
+    }
+
+    std::string demangle(const char *symbol) {
+        std::string line = symbol;
+        auto open = line.find('(');
+        auto plus = line.find('+', open);
+        if (open == std::string::npos || plus == std::string::npos || plus == open + 1) {
+            return line;
+        }
+        auto mangled = line.substr(open + 1, plus - open - 1);
+        auto status = 0;
+        auto demangled = abi::__cxa_demangle(mangled.c_str(), nullptr, nullptr, &status);
+        if (status != 0) {
+            return line;
+        }
+        std::string name = demangled;
+        std::free(demangled);
+        return name;
+    }
+
+    bool check(const std::string &name, std::size_t iterations, const std::function<void()> &scenario) {
+        for (auto i = 0; i < 3; i++) {
+            scenario();
+        }
+        siteCount = 0;
+        allocations = 0;
+        counting = true;
+        for (std::size_t i = 0; i < iterations; i++) {
+            scenario();
+        }
+        counting = false;
+
+        auto count = allocations.load();
+        std::cout << (count == 0 ? "ok   " : "FAIL ") << name << ": " << count << " allocations in "
+                  << iterations << " iterations" << std::endl;
+        for (std::size_t i = 0; i < siteCount; i++) {
+            std::cout << "  " << sites[i].count << " from:" << std::endl;
+            auto symbols = backtrace_symbols(sites[i].frames, sites[i].depth);
+            // Skip recordAllocation and operator new themselves.
+            for (auto frame = 2; frame < sites[i].depth && symbols != nullptr; frame++) {
+                std::cout << "    " << demangle(symbols[frame]) << std::endl;
+            }
+            std::free(symbols);
+        }
+        return count == 0;
+    }
+}
+
+void *operator new(std::size_t size) {
+    recordAllocation();
+    if (auto pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+int main() {
+    void *warmup[1];
+    backtrace(warmup, 1);
+
+    auto random = std::mt19937_64(1);
+    auto game = BitsetOneToOneGame(7);
+    for (auto i = 0; i < 30; i++) {
+        auto legalMoves = game.legalMoves();
+        game.makeMove(legalMoves[random() % legalMoves.size()]);
+    }
+    const auto position = game.position();
+    const auto move = game.legalMoves().front();
+    auto handle = create(7);
+    std::vector<uint32_t> offsets = {};
+    for (const auto &played: game.moves()) {
+        offsets.emplace_back(played.toOffset());
+    }
+    makeMoves(handle, offsets.data(), offsets.size(), nullptr);
+
+    auto passed = true;
+    passed &= check("position.legalBoard", 1000, [&position] {
+        auto legalBoard = position.legalBoard();
+        asm volatile("" : : "r,m"(legalBoard) : "memory");
+    });
+    passed &= check("position.successor", 1000, [&position, &move] {
+        auto successor = position.successor(move);
+        asm volatile("" : : "r,m"(successor) : "memory");
+    });
+    passed &= check("game.makeMove", 1000, [&game, &move] {
+        auto copy = game;
+        copy.makeMove(move);
+    });
+    passed &= check("game.undoRedo", 100, [&game] {
+        game.undo();
+        game.redo();
+    });
+    passed &= check("playout", 100, [&position, &random] {
+        unsigned long long nodes = 0;
+        auto firstWins = BitsetMonteCarloEngine::playout(position, random, nodes);
+        asm volatile("" : : "r,m"(firstWins) : "memory");
+    });
+    passed &= check("capi.tryMakeMoveUndo", 1000, [handle, &move] {
+        tryMakeMove(handle, move.toOffset());
+        tryUndo(handle);
+    });
+    passed &= check("capi.copyLegalMoves", 1000, [handle] {
+        uint8_t legalMoves[140];
+        auto count = copyLegalMoves(handle, legalMoves, sizeof(legalMoves));
+        asm volatile("" : : "r,m"(count) : "memory");
+    });
+    passed &= check("capi.getSnapshot", 1000, [handle] {
+        MosaicSnapshot snapshot = {};
+        getSnapshot(handle, &snapshot);
+        asm volatile("" : : "r,m"(snapshot) : "memory");
+    });
+    passed &= check("capi.resetGame", 1000, [handle, &offsets] {
+        resetGame(handle, 7);
+        makeMoves(handle, offsets.data(), offsets.size(), nullptr);
+    });
+    destroy(handle);
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,331 @@
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "library.h"
+#include "Benchmark/BenchmarkSuite.h"
+#include "Engine/BitsetMonteCarloEngine.h"
+#include "Game/BitsetOneToOneGame.h"
+#include "Game/BitsetPosition.h"
+#include "Game/WordPosition.h"
+
+using MosaicGame::Benchmark::BenchmarkOptions;
+using MosaicGame::Benchmark::BenchmarkSuite;
+using MosaicGame::Benchmark::doNotOptimize;
+using MosaicGame::Engine::BitsetMonteCarloEngine;
+using MosaicGame::Engine::MonteCarloEngine;
+using MosaicGame::Game::BitsetOneToOneGame;
+using MosaicGame::Game::BitsetPosition;
+using MosaicGame::Game::WordPosition;
+
+using LargeWordPosition = WordPosition<MosaicGame::Board::pyramidWords(12)>;
+
+// Finds a game prefix after which the next move places exactly one piece (or more, when chained).
+static std::vector<BitsetMove> prefixBefore(bool chained) {
+    auto random = std::mt19937_64(chained ? 1 : 2);
+    while (true) {
+        auto position = BitsetPosition(7);
+        std::vector<BitsetMove> moves = {};
+        while (!position.isOver()) {
+            auto legalMoves = BitsetMove::fromBoard(position.legalBoard());
+            auto move = legalMoves[random() % legalMoves.size()];
+            auto next = position.successor(move);
+            auto placed = next.occupiedBoard().count() - position.occupiedBoard().count();
+            if (moves.size() >= 20 && (placed > 1) == chained) {
+                moves.emplace_back(move);
+                return moves;
+            }
+            moves.emplace_back(move);
+            position = next;
+        }
+    }
+}
+
+static BitsetOneToOneGame gameAfter(const std::vector<BitsetMove> &moves) {
+    auto game = BitsetOneToOneGame(7);
+    for (const auto &move: moves) {
+        game.makeMove(move);
+    }
+    return game;
+}
+
+static void addBoardScenarios(BenchmarkSuite &suite) {
+    const auto board = gameAfter(prefixBefore(true)).firstBoard();
+    const std::vector<std::pair<std::string, BitsetBoard (BitsetBoard::*)() const>> operations = {
+            {"promoteZero",       &BitsetBoard::promoteZero},
+            {"promoteOne",        &BitsetBoard::promoteOne},
+            {"promoteTwo",        &BitsetBoard::promoteTwo},
+            {"promoteThree",      &BitsetBoard::promoteThree},
+            {"promoteFour",       &BitsetBoard::promoteFour},
+            {"promoteHalfOrMore", &BitsetBoard::promoteHalfOrMore},
+            {"promoteMajority",   &BitsetBoard::promoteMajority},
+            {"mirrorHorizontal",  &BitsetBoard::mirrorHorizontal},
+            {"flipVertical",      &BitsetBoard::flipVertical},
+            {"flipDiagonal",      &BitsetBoard::flipDiagonal},
+            {"rotate90",          &BitsetBoard::rotate90},
+            {"rotate180",         &BitsetBoard::rotate180},
+            {"rotate270",         &BitsetBoard::rotate270},
+    };
+    for (const auto &[name, operation]: operations) {
+        suite.add("board." + name, [board, operation = operation](std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; i++) {
+                doNotOptimize((board.*operation)());
+            }
+        });
+    }
+    suite.add("board.count", [board](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++) {
+            doNotOptimize(board.count());
+        }
+    });
+}
+
+// The same operations on a WordBoard holding the same pieces, to compare with the BitsetBoard fast path.
+static void addWordBoardScenarios(BenchmarkSuite &suite) {
+    const auto board = WordBoard<3>(7, gameAfter(prefixBefore(true)).firstBoard().toString());
+    const std::vector<std::pair<std::string, WordBoard<3> (WordBoard<3>::*)() const>> operations = {
+            {"promoteFour",      &WordBoard<3>::promoteFour},
+            {"promoteMajority",  &WordBoard<3>::promoteMajority},
+            {"mirrorHorizontal", &WordBoard<3>::mirrorHorizontal},
+            {"flipVertical",     &WordBoard<3>::flipVertical},
+            {"flipDiagonal",     &WordBoard<3>::flipDiagonal},
+            {"rotate90",         &WordBoard<3>::rotate90},
+    };
+    for (const auto &[name, operation]: operations) {
+        suite.add("wordBoard." + name, [board, operation = operation](std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; i++) {
+                doNotOptimize((board.*operation)());
+            }
+        });
+    }
+}
+
+static void addGameScenarios(BenchmarkSuite &suite) {
+    for (auto chained: {false, true}) {
+        auto moves = prefixBefore(chained);
+        auto move = moves.back();
+        moves.pop_back();
+        auto game = gameAfter(moves);
+        auto position = game.position();
+        auto suffix = std::string(chained ? "chain" : "quiet");
+
+        suite.add("position.successor." + suffix, [position, move](std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; i++) {
+                doNotOptimize(position.successor(move));
+            }
+        });
+        suite.add("game.makeMove." + suffix, [game, move](std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; i++) {
+                auto copy = game;
+                copy.makeMove(move);
+                doNotOptimize(copy);
+            }
+        });
+        if (!chained) {
+            auto rotated = game;
+            rotated.rotate90();
+            auto rotatedMove = BitsetMove::fromBoard(move.toBoard(7).rotate90()).front();
+            suite.add("game.makeMove.rotated", [rotated, rotatedMove](std::size_t iterations) {
+                for (std::size_t i = 0; i < iterations; i++) {
+                    auto copy = rotated;
+                    copy.makeMove(rotatedMove);
+                    doNotOptimize(copy);
+                }
+            });
+            suite.add("game.rotate90", [game](std::size_t iterations) {
+                auto copy = game;
+                for (std::size_t i = 0; i < iterations; i++) {
+                    copy.rotate90();
+                    doNotOptimize(copy);
+                }
+            });
+            suite.add("movegen.legalBoard", [position](std::size_t iterations) {
+                for (std::size_t i = 0; i < iterations; i++) {
+                    doNotOptimize(position.legalBoard());
+                }
+            });
+            suite.add("movegen.legalMoves", [game](std::size_t iterations) {
+                for (std::size_t i = 0; i < iterations; i++) {
+                    doNotOptimize(game.legalMoves());
+                }
+            });
+            suite.add("game.undoRedo", [game](std::size_t iterations) {
+                auto copy = game;
+                for (std::size_t i = 0; i < iterations; i++) {
+                    copy.undo();
+                    copy.redo();
+                }
+                doNotOptimize(copy);
+            });
+        }
+    }
+
+    for (unsigned char size = 2; size <= BitsetBoard::MaxSize; size++) {
+        suite.add("playout.size" + std::to_string(size), [size](std::size_t iterations) {
+            auto random = std::mt19937_64(size);
+            unsigned long long nodes = 0;
+            for (std::size_t i = 0; i < iterations; i++) {
+                doNotOptimize(BitsetMonteCarloEngine::playout(BitsetPosition(size), random, nodes));
+            }
+        });
+    }
+    suite.add("wordPlayout.size7", [](std::size_t iterations) {
+        auto random = std::mt19937_64(7);
+        unsigned long long nodes = 0;
+        for (std::size_t i = 0; i < iterations; i++) {
+            doNotOptimize(MonteCarloEngine<WordPosition<3>>::playout(WordPosition<3>(7), random, nodes));
+        }
+    });
+    for (unsigned char size: {7, 10, 12}) {
+        suite.add("wordPlayout.large.size" + std::to_string(size), [size](std::size_t iterations) {
+            auto random = std::mt19937_64(size);
+            unsigned long long nodes = 0;
+            for (std::size_t i = 0; i < iterations; i++) {
+                doNotOptimize(MonteCarloEngine<LargeWordPosition>::playout(LargeWordPosition(size), random, nodes));
+            }
+        });
+    }
+    suite.add("game.firstLegal.size7", [](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++) {
+            auto game = BitsetOneToOneGame(7);
+            while (!game.isOver()) {
+                game.makeMove(game.legalMoves()[0]);
+            }
+            doNotOptimize(game);
+        }
+    });
+}
+
+static void addLibraryScenarios(BenchmarkSuite &suite) {
+    auto moves = prefixBefore(false);
+    std::vector<uint32_t> offsets = {};
+    for (const auto &move: moves) {
+        offsets.emplace_back(move.toOffset());
+    }
+
+    suite.add("capi.createDestroy", [](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++) {
+            destroy(create(7));
+        }
+    });
+    suite.add("capi.makeMovesReset", [offsets](std::size_t iterations) {
+        auto game = create(7);
+        for (std::size_t i = 0; i < iterations; i++) {
+            doNotOptimize(makeMoves(game, offsets.data(), offsets.size(), nullptr));
+            resetGame(game, 7);
+        }
+        destroy(game);
+    });
+
+    // Only when the library was built with GMP.
+    if (auto gmpGame = createWithBackend(7, "gmp"); gmpGame != nullptr) {
+        suite.add("capi.gmp.makeMovesReset", [gmpGame, offsets](std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; i++) {
+                doNotOptimize(makeMoves(gmpGame, offsets.data(), offsets.size(), nullptr));
+                resetGame(gmpGame, 7);
+            }
+        });
+    }
+
+    auto game = create(7);
+    makeMoves(game, offsets.data(), offsets.size(), nullptr);
+    suite.add("capi.isLegalMove", [game](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++) {
+            doNotOptimize(isLegalMove(game, i % 140));
+        }
+    });
+    suite.add("capi.getSnapshot", [game](std::size_t iterations) {
+        MosaicSnapshot snapshot = {};
+        for (std::size_t i = 0; i < iterations; i++) {
+            getSnapshot(game, &snapshot);
+            doNotOptimize(snapshot);
+        }
+    });
+    suite.add("capi.copyLegalMoves", [game](std::size_t iterations) {
+        uint8_t legalMoves[140];
+        for (std::size_t i = 0; i < iterations; i++) {
+            doNotOptimize(copyLegalMoves(game, legalMoves, sizeof(legalMoves)));
+        }
+    });
+    suite.add("capi.copyLegalBoardString", [game](std::size_t iterations) {
+        char board[141];
+        for (std::size_t i = 0; i < iterations; i++) {
+            copyLegalBoard(game, board);
+            doNotOptimize(board);
+        }
+    });
+}
+
+int main(int argc, char **argv) {
+    BenchmarkOptions options = {};
+    std::string jsonPath;
+    std::string baselinePath;
+    auto threshold = 5.0;
+    auto cpu = -1;
+    for (auto i = 1; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value = argv[i + 1];
+        if (option == "--filter") {
+            options.filter = value;
+        } else if (option == "--samples") {
+            options.samples = std::stoull(value);
+        } else if (option == "--warmup") {
+            options.warmupSamples = std::stoull(value);
+        } else if (option == "--cpu") {
+            cpu = std::stoi(value);
+        } else if (option == "--json") {
+            jsonPath = value;
+        } else if (option == "--baseline") {
+            baselinePath = value;
+        } else if (option == "--threshold") {
+            threshold = std::stod(value);
+        } else {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return 1;
+        }
+    }
+    if (argc % 2 == 0) {
+        std::cerr << "Usage: bench [--filter TEXT] [--samples N] [--warmup N] [--cpu N] [--json PATH]"
+                  << " [--baseline PATH] [--threshold PERCENT]" << std::endl;
+        return 1;
+    }
+    if (cpu >= 0 && !BenchmarkSuite::pinToCpu(cpu)) {
+        std::cerr << "Pinning to CPU " << cpu << " failed." << std::endl;
+    }
+
+    BenchmarkSuite suite;
+    addBoardScenarios(suite);
+    addWordBoardScenarios(suite);
+    addGameScenarios(suite);
+    addLibraryScenarios(suite);
+
+    auto baseline = baselinePath.empty() ? std::map<std::string, double>{} : BenchmarkSuite::readBaseline(baselinePath);
+    auto results = suite.run(options);
+    auto regressions = 0;
+    std::cout << std::fixed << std::setprecision(1);
+    for (const auto &result: results) {
+        std::cout << std::left << std::setw(32) << result.name << std::right
+                  << " median " << std::setw(12) << result.median << " ns"
+                  << "  p99 " << std::setw(12) << result.p99 << " ns";
+        auto previous = baseline.find(result.name);
+        if (previous != baseline.end()) {
+            auto change = 100.0 * (result.median / previous->second - 1.0);
+            std::cout << "  " << std::showpos << change << std::noshowpos << "%";
+            if (change > threshold) {
+                std::cout << " REGRESSION";
+                regressions++;
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    if (!jsonPath.empty()) {
+        std::ofstream(jsonPath) << BenchmarkSuite::toJson(results);
+    }
+
+    return regressions == 0 ? 0 : 3;
+}
@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Game/BitsetOneToOneGame.h"
+#include "Game/BitsetPosition.h"
+#include "Game/WordOneToOneGame.h"
+#include "Verification/BitsetPositionBackend.h"
+#include "Verification/DifferentialTester.h"
+#include "Verification/ReferenceBackend.h"
+#include "Verification/WordPositionBackend.h"
+
+#ifdef MOSAICGAME_WITH_GMP
+#include "Game/GMPOneToOneGame.h"
+
+using MosaicGame::Game::GMPOneToOneGame;
+#endif
+
+using MosaicGame::Game::BitsetOneToOneGame;
+using MosaicGame::Game::BitsetPosition;
+using MosaicGame::Game::WordOneToOneGame;
+using MosaicGame::Verification::BitsetPositionBackend;
+using MosaicGame::Verification::DifferentialAction;
+using MosaicGame::Verification::DifferentialBackend;
+using MosaicGame::Verification::DifferentialConfiguration;
+using MosaicGame::Verification::DifferentialFailure;
+using MosaicGame::Verification::DifferentialTester;
+using MosaicGame::Verification::OneToOneGameBackend;
+using MosaicGame::Verification::ReferenceBackend;
+using MosaicGame::Verification::WordPositionBackend;
+
+static void printFailure(const DifferentialFailure &failure) {
+    std::cout << "divergence in game " << failure.game << " (size " << (unsigned int) failure.size << ") on backend "
+              << failure.backend << " after " << failure.step << " actions" << std::endl;
+    std::cout << "actions:";
+    for (const auto &action: failure.actions) {
+        std::cout << ' ' << action.toString();
+    }
+    std::cout << std::endl;
+    for (const auto &difference: failure.differences) {
+        std::cout << "  " << difference << std::endl;
+    }
+}
+
+static std::string describe(const std::vector<BitsetMove> &moves) {
+    std::string description;
+    for (const auto &move: moves) {
+        description += (description.empty() ? "" : " ") + std::to_string(move.toOffset());
+    }
+    return description;
+}
+
+// Checks BitsetPosition::predecessors() against successor() along random games: every listed parent must lead
+// back to the position, and every successor of a position reached in play must list it, chains included.
+static int checkPredecessors(const DifferentialConfiguration &configuration) {
+    auto maxSize = std::min<unsigned char>(configuration.maxSize, BitsetBoard::MaxSize);
+    std::uint64_t positions = 0;
+    std::uint64_t chainedMoves = 0;
+    for (std::uint64_t game = 0; game < configuration.games; game++) {
+        auto size = (unsigned char) (configuration.minSize + game % (maxSize - configuration.minSize + 1));
+        std::mt19937_64 random(configuration.seed + game);
+        auto position = BitsetPosition(size);
+        std::vector<BitsetMove> moves = {};
+        while (!position.isOver()) {
+            auto legalMoves = BitsetMove::fromBoard(position.legalBoard());
+            for (const auto &move: legalMoves) {
+                auto successor = position.successor(move);
+                if (successor.occupiedBoard().count() > position.occupiedBoard().count() + 1) {
+                    chainedMoves++;
+                }
+                auto predecessors = successor.predecessors();
+                for (const auto &[parent, parentMove]: predecessors) {
+                    if (parent.isOver() || !parent.isLegalMove(parentMove)
+                        || !(parent.successor(parentMove) == successor)) {
+                        std::cout << "bad predecessor in game " << game << " (size " << (unsigned int) size
+                                  << ") after moves [" << describe(moves) << "] then " << move.toOffset()
+                                  << ": move " << parentMove.toOffset() << " does not lead back" << std::endl;
+                        return 2;
+                    }
+                }
+                auto found = std::any_of(predecessors.begin(), predecessors.end(), [&](const auto &predecessor) {
+                    return predecessor.first == position && predecessor.second.toOffset() == move.toOffset();
+                });
+                if (!found) {
+                    std::cout << "missing predecessor in game " << game << " (size " << (unsigned int) size
+                              << ") after moves [" << describe(moves) << "]: move " << move.toOffset()
+                              << " is not listed" << std::endl;
+                    return 2;
+                }
+                positions++;
+            }
+            auto move = legalMoves[random() % legalMoves.size()];
+            moves.emplace_back(move);
+            position = position.successor(move);
+        }
+    }
+    std::cerr << configuration.games << " games, " << positions << " successors, " << chainedMoves
+              << " with chains" << std::endl;
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    DifferentialConfiguration configuration = {};
+    std::string replay;
+    std::string mode = "backends";
+    auto replaySize = 7;
+    for (auto i = 1; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value = argv[i + 1];
+        if (option == "--games") {
+            configuration.games = std::stoull(value);
+        } else if (option == "--threads") {
+            configuration.threads = std::stoul(value);
+        } else if (option == "--seed") {
+            configuration.seed = std::stoull(value);
+        } else if (option == "--sizes") {
+            auto dash = value.find('-');
+            configuration.minSize = std::stoul(value.substr(0, dash));
+            configuration.maxSize = dash == std::string::npos ? configuration.minSize : std::stoul(value.substr(dash + 1));
+        } else if (option == "--mode") {
+            mode = value;
+        } else if (option == "--replay") {
+            replay = value;
+        } else if (option == "--size") {
+            replaySize = std::stoi(value);
+        } else {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return 1;
+        }
+    }
+    if (argc % 2 == 0) {
+        std::cerr << "Usage: differential [--mode backends|predecessors] [--games N] [--threads N] [--seed N]"
+                  << " [--sizes MIN-MAX] [--replay \"m12 u r t3 ...\" --size N]" << std::endl;
+        return 1;
+    }
+
+    if (mode == "predecessors") {
+        return checkPredecessors(configuration);
+    }
+    if (mode != "backends") {
+        std::cerr << "Unknown mode: " << mode << std::endl;
+        return 1;
+    }
+
+    std::vector<DifferentialTester::BackendFactory> factories = {
+            [] { return std::make_unique<ReferenceBackend>(); },
+            [] { return std::make_unique<BitsetPositionBackend>(); },
+            [] { return std::make_unique<WordPositionBackend<3>>("word3-position"); },
+            [] {
+                return std::make_unique<WordPositionBackend<MosaicGame::Board::pyramidWords(12)>>("word11-position");
+            },
+            [] {
+                return std::make_unique<OneToOneGameBackend<BitsetOneToOneGame>>(
+                        "bitset-game", BitsetBoard::MaxSize);
+            },
+            [] {
+                return std::make_unique<OneToOneGameBackend<WordOneToOneGame<MosaicGame::Board::pyramidWords(12)>>>(
+                        "word-game", 12);
+            },
+#ifdef MOSAICGAME_WITH_GMP
+            [] {
+                return std::make_unique<OneToOneGameBackend<GMPOneToOneGame>>("gmp-game", 12);
+            },
+#endif
+    };
+    std::cerr << "backends:";
+    for (const auto &factory: factories) {
+        std::cerr << ' ' << factory()->name();
+    }
+    std::cerr << std::endl;
+    auto tester = DifferentialTester(factories);
+
+    if (!replay.empty()) {
+        std::vector<DifferentialAction> actions = {};
+        std::istringstream tokens(replay);
+        std::string token;
+        while (tokens >> token) {
+            actions.emplace_back(DifferentialAction::fromString(token));
+        }
+        auto failure = tester.check(replaySize, actions);
+        if (!failure.has_value()) {
+            std::cout << "no divergence in " << actions.size() << " actions" << std::endl;
+            return 0;
+        }
+        printFailure(*failure);
+        return 2;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = tester.run(configuration);
+    auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << result.games << " games, " << result.actions << " actions, " << seconds << " seconds" << std::endl;
+    if (result.failure.has_value()) {
+        printFailure(*result.failure);
+        return 2;
+    }
+
+    return 0;
+}
@@ -0,0 +1,243 @@
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "Engine/BitsetAsyncSearch.h"
+#include "Engine/BitsetEngineFactory.h"
+#include "Game/BitsetOneToOneGame.h"
+
+using MosaicGame::Engine::BitsetAsyncSearch;
+using MosaicGame::Engine::BitsetEngineFactory;
+using MosaicGame::Engine::BitsetSearchProgress;
+using MosaicGame::Game::BitsetOneToOneGame;
+using MosaicGame::Game::GameStatus;
+
+// Line-based engine protocol in the spirit of UCI. Commands:
+//   mgi                                        identify; answered with "id ..." lines and "mgiok"
+//   isready                                    answered with "readyok"
+//   setoption name (engine|seed) value VALUE   engine specification or search seed
+//   position SIZE [moves M...]                 start a new game and play the moves
+//   move M... / undo                           change the current game
+//   go [movetime MS] [nodes N]                 search; "info" lines while running, then "bestmove M". The
+//                                              default engine stops after 256 playouts; montecarlo:0 only
+//                                              stops at a limit or "stop"
+//   stop                                       end the running search early
+//   show                                       print the current game
+//   quit
+namespace {
+    std::mutex outputMutex;
+
+    void output(const std::string &line) {
+        std::lock_guard<std::mutex> lock(outputMutex);
+        std::cout << line << std::endl;
+    }
+
+    std::string info(const BitsetSearchProgress &progress, std::chrono::steady_clock::time_point start) {
+        auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+        std::ostringstream line;
+        line << "info depth " << progress.depth
+             << " iterations " << progress.iterations
+             << " nodes " << progress.nodes
+             << " nps " << (milliseconds == 0 ? 0 : progress.nodes * 1000 / milliseconds)
+             << " time " << milliseconds;
+        if (progress.bestMove.has_value()) {
+            line << " bestmove " << progress.bestMove->toOffset();
+        }
+        return line.str();
+    }
+
+    class Session {
+    public:
+        Session() : _game(std::make_unique<BitsetOneToOneGame>(7)), _engine("montecarlo"), _seed(0) {}
+
+        ~Session() {
+            this->stop();
+        }
+
+        bool handle(const std::string &line) {
+            std::istringstream tokens(line);
+            std::string command;
+            if (!(tokens >> command)) {
+                return true;
+            }
+
+            if (command == "quit") {
+                return false;
+            } else if (command == "mgi") {
+                output("id name mosaicgame");
+                output("option name engine default montecarlo");
+                output("option name seed default 0");
+                output("mgiok");
+            } else if (command == "isready") {
+                output("readyok");
+            } else if (command == "stop") {
+                this->stop();
+            } else if (command == "setoption") {
+                this->setOption(tokens);
+            } else if (command == "position") {
+                this->stop();
+                this->position(tokens);
+            } else if (command == "move") {
+                this->stop();
+                this->moves(tokens);
+            } else if (command == "undo") {
+                this->stop();
+                if (this->_game->tryUndo() != GameStatus::Ok) {
+                    output("error Nothing to undo.");
+                }
+            } else if (command == "go") {
+                this->go(tokens);
+            } else if (command == "show") {
+                this->show();
+            } else {
+                output("error Unknown command: " + command);
+            }
+            return true;
+        }
+
+    private:
+        std::unique_ptr<BitsetOneToOneGame> _game;
+        std::string _engine;
+        std::uint64_t _seed;
+        std::unique_ptr<BitsetAsyncSearch> _search;
+        std::thread _reporter;
+
+        void setOption(std::istringstream &tokens) {
+            std::string keyword, name, value;
+            tokens >> keyword >> name >> keyword >> value;
+            try {
+                if (name == "engine") {
+                    (void) BitsetEngineFactory::create(value);
+                    this->_engine = value;
+                } else if (name == "seed") {
+                    this->_seed = std::stoull(value);
+                } else {
+                    output("error Unknown option: " + name);
+                }
+            } catch (const std::exception &exception) {
+                output(std::string("error ") + exception.what());
+            }
+        }
+
+        void position(std::istringstream &tokens) {
+            unsigned int size = 0;
+            if (!(tokens >> size) || size < 1 || size > BitsetBoard::MaxSize) {
+                output("error Invalid size.");
+                return;
+            }
+            this->_game = std::make_unique<BitsetOneToOneGame>(size);
+            std::string keyword;
+            if (tokens >> keyword && keyword == "moves") {
+                this->moves(tokens);
+            }
+        }
+
+        void moves(std::istringstream &tokens) {
+            unsigned int offset = 0;
+            while (tokens >> offset) {
+                auto status = this->_game->tryMakeMove(BitsetMove(offset));
+                if (status == GameStatus::GameOver) {
+                    output("error The game is already over.");
+                    return;
+                }
+                if (status != GameStatus::Ok) {
+                    output("error Illegal move: " + std::to_string(offset));
+                    return;
+                }
+            }
+        }
+
+        void go(std::istringstream &tokens) {
+            if (this->_search != nullptr && this->_search->isDone()) {
+                this->stop();
+            }
+            if (this->_search != nullptr) {
+                output("error A search is already running.");
+                return;
+            }
+            auto position = this->_game->position();
+            if (position.isOver()) {
+                output("error The game is already over.");
+                return;
+            }
+
+            unsigned long long movetime = 0;
+            auto nodes = std::numeric_limits<unsigned long long>::max();
+            std::string keyword;
+            while (tokens >> keyword) {
+                if (keyword == "movetime") {
+                    tokens >> movetime;
+                } else if (keyword == "nodes") {
+                    tokens >> nodes;
+                } else {
+                    output("error Unknown search limit: " + keyword);
+                    return;
+                }
+            }
+
+            this->_search = std::make_unique<BitsetAsyncSearch>(
+                    BitsetEngineFactory::create(this->_engine), position, this->_seed,
+                    std::chrono::milliseconds(movetime), nodes);
+            this->_reporter = std::thread([search = this->_search.get()]() {
+                auto start = std::chrono::steady_clock::now();
+                auto reported = start;
+                while (!search->isDone()) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    if (std::chrono::steady_clock::now() - reported >= std::chrono::milliseconds(500)) {
+                        reported = std::chrono::steady_clock::now();
+                        output(info(search->progress(), start));
+                    }
+                }
+                try {
+                    auto result = search->wait();
+                    output(info(search->progress(), start));
+                    output("bestmove " + std::to_string(result.bestMove.toOffset()));
+                } catch (const std::exception &exception) {
+                    output(std::string("error ") + exception.what());
+                }
+            });
+        }
+
+        void stop() {
+            if (this->_search == nullptr) {
+                return;
+            }
+            this->_search->cancel();
+            this->_reporter.join();
+            this->_search.reset();
+        }
+
+        void show() {
+            const auto &game = *this->_game;
+            std::ostringstream line;
+            line << "size " << (unsigned int) game.size()
+                 << " turn " << (game.isFirstTurn() ? "first" : "second")
+                 << " score " << game.firstScore() << ' ' << game.secondScore()
+                 << " over " << (game.isOver() ? "true" : "false")
+                 << " moves";
+            for (const auto &move: game.moves()) {
+                line << ' ' << move.toOffset();
+            }
+            line << " legal";
+            for (const auto &move: game.legalMoves()) {
+                line << ' ' << move.toOffset();
+            }
+            output(line.str());
+        }
+    };
+}
+
+int main() {
+    std::ios::sync_with_stdio(false);
+    Session session;
+    std::string line;
+    while (std::getline(std::cin, line) && session.handle(line)) {}
+
+    return 0;
+}
@@ -1,135 +1,915 @@
+#include <algorithm>
+#include <bit>
 #include <cstring>
+#include <string>
+#include <type_traits>
 #include "library.h"
+#include "Game/AnyOneToOneGame.h"
+#include "Game/BitsetFeaturePlanes.h"
+#include "Game/BitsetGamePool.h"
 #include "Game/BitsetOneToOneGame.h"
+#include "Game/WordOneToOneGame.h"
 #include "Game/Move/BitsetMove.h"
-
+#include "Book/BitsetOpeningBook.h"
+#include "Engine/BitsetAsyncSearch.h"
+#include "Engine/BitsetEngineFactory.h"
+#include "Instrumentation/Instrumentation.h"
+#include "Instrumentation/Tracer.h"
+#include "Record/BitsetGameRecordReader.h"
+#include "Record/BitsetGameRecordWriter.h"
+#include "Record/BitsetGameValidator.h"
+#include "SelfPlay/WorkStealingPool.h"
+#include "SelfPlay/BitsetSelfPlay.h"
+
+#ifdef MOSAICGAME_WITH_GMP
+#include "Game/GMPOneToOneGame.h"
+
+using MosaicGame::Game::GMPOneToOneGame;
+#endif
+
+using MosaicGame::Board::BitsetBoard;
+using MosaicGame::Board::BitsetCellGeometry;
+using MosaicGame::Board::CellCoordinate;
+using MosaicGame::Book::BitsetOpeningBook;
+using MosaicGame::Engine::BitsetAsyncSearch;
+using MosaicGame::Engine::BitsetEngineFactory;
+using MosaicGame::Game::AnyOneToOneGame;
+using MosaicGame::Game::BitsetFeaturePlanes;
+using MosaicGame::Game::BitsetGamePool;
 using MosaicGame::Game::BitsetOneToOneGame;
+using MosaicGame::Game::GameStatus;
+using MosaicGame::Game::WordOneToOneGame;
+using MosaicGame::Instrumentation::Instrumentation;
+using MosaicGame::Instrumentation::Tracer;
 using MosaicGame::Game::Move::BitsetMove;
+using MosaicGame::Record::BitsetGameRecord;
+using MosaicGame::Record::BitsetGameRecordReader;
+using MosaicGame::Record::BitsetGameRecordWriter;
+using MosaicGame::Record::BitsetGameValidator;
+using MosaicGame::SelfPlay::WorkStealingPool;
+using MosaicGame::SelfPlay::BitsetSelfPlay;
+using MosaicGame::SelfPlay::BitsetSelfPlayConfiguration;
+
+// The "word" backend, for sizes up to 12.
+using WordGame = WordOneToOneGame<MosaicGame::Board::pyramidWords(12)>;
+
+static void copyWords(const BitsetBoard &board, uint64_t *words) {
+    auto packed = board.words();
+    std::copy(packed.begin(), packed.end(), words);
+}
+
+template<typename T>
+static size_t copyOffsets(const BitsetBoard &board, T *offsets, size_t capacity) {
+    size_t count = 0;
+    auto packed = board.words();
+    for (unsigned int i = 0; i < packed.size(); i++) {
+        for (auto word = packed[i]; word != 0; word &= word - 1) {
+            if (count < capacity) {
+                offsets[count] = (T) (i * 64 + std::countr_zero(word));
+            }
+            count++;
+        }
+    }
+    return count;
+}
+
+// Games from createWithBackend() on a backend other than the bitset one are AnyOneToOneGame objects whose handles
+// have the lowest bit set. Every other handle is a pooled BitsetOneToOneGame, which is at least 2-byte aligned.
+static bool isAnyGame(void *gamePointer) {
+    return ((uintptr_t) gamePointer & 1) != 0;
+}
+
+static AnyOneToOneGame *anyGame(void *gamePointer) {
+    return (AnyOneToOneGame *) ((uintptr_t) gamePointer & ~(uintptr_t) 1);
+}
+
+static void *anyGameHandle(AnyOneToOneGame *game) {
+    return (void *) ((uintptr_t) game | 1);
+}
+
+// Calls function with the game behind a handle, either an AnyOneToOneGame or a BitsetOneToOneGame. The function
+// is generic over both; the helpers below bridge where their interfaces differ.
+template<typename FUNCTION>
+static auto dispatch(void *gamePointer, FUNCTION &&function) {
+    if (isAnyGame(gamePointer)) {
+        return function(*anyGame(gamePointer));
+    }
+    return function(*(BitsetOneToOneGame *) gamePointer);
+}
+
+template<typename GAME>
+static constexpr bool isBitsetGame = std::is_same_v<std::remove_cvref_t<GAME>, BitsetOneToOneGame>;
+
+// The bitset game behind a handle, or nullptr for the features that need one.
+static BitsetOneToOneGame *bitsetGame(void *gamePointer) {
+    return isAnyGame(gamePointer) ? nullptr : (BitsetOneToOneGame *) gamePointer;
+}
+
+static unsigned int gameMove(const AnyOneToOneGame &, unsigned int offset) {
+    return offset;
+}
+
+static BitsetMove gameMove(const BitsetOneToOneGame &, unsigned int offset) {
+    return BitsetMove(offset);
+}
+
+static unsigned int moveOffset(unsigned int move) {
+    return move;
+}
+
+static unsigned int moveOffset(const BitsetMove &move) {
+    return move.toOffset();
+}
+
+static std::string boardString(std::string board) {
+    return board;
+}
+
+static std::string boardString(const BitsetBoard &board) {
+    return board.toString();
+}
+
+// From a toString() board, highest offset first. Cells past the words are dropped.
+static void copyWords(const std::string &board, uint64_t *words) {
+    std::fill(words, words + MOSAIC_BOARD_WORDS, 0);
+    auto length = std::min(board.size(), (size_t) MOSAIC_BOARD_WORDS * 64);
+    for (size_t i = 0; i < length; i++) {
+        if (board[board.size() - i - 1] == '1') {
+            words[i / 64] |= (uint64_t) 1 << (i % 64);
+        }
+    }
+}
+
+template<typename T>
+static size_t copyOffsets(const std::vector<unsigned int> &moves, T *offsets, size_t capacity) {
+    for (size_t i = 0; i < moves.size() && i < capacity; i++) {
+        offsets[i] = (T) moves[i];
+    }
+    return moves.size();
+}
+
+// The helpers below are the bodies of exported functions that other exported functions share; they are not
+// instrumented, so a call is recorded once, by the function the caller entered through.
+static void *createGame(unsigned char size) {
+    if (size < 1 || size > BitsetBoard::MaxSize) {
+        return nullptr;
+    }
+    return (void *) BitsetGamePool::acquire(size);
+}
+
+static MosaicStatus makeGameMove(void *gamePointer, unsigned int offset) {
+    return dispatch(gamePointer, [offset](auto &game) {
+        return (MosaicStatus) game.tryMakeMove(gameMove(game, offset));
+    });
+}
+
+static void writeSnapshot(void *gamePointer, MosaicSnapshot *snapshot) {
+    if (auto game = bitsetGame(gamePointer)) {
+        auto position = game->position();
+        snapshot->size = game->size();
+        snapshot->isFirstTurn = position.isFirstTurn();
+        snapshot->isOver = position.isOver();
+        snapshot->firstWins = position.firstWins();
+        snapshot->secondWins = position.secondWins();
+        snapshot->movesMade = game->movesMade();
+        snapshot->piecesPerPlayer = position.piecesPerPlayer();
+        snapshot->firstScore = position.firstBoard().count();
+        snapshot->secondScore = position.secondBoard().count();
+        copyWords(position.firstBoard(), snapshot->firstBoard);
+        copyWords(position.secondBoard(), snapshot->secondBoard);
+        copyWords(position.neutralBoard(), snapshot->neutralBoard);
+        copyWords(position.legalBoard(), snapshot->legalBoard);
+        return;
+    }
+    auto game = anyGame(gamePointer);
+    snapshot->size = game->size();
+    snapshot->isFirstTurn = game->isFirstTurn();
+    snapshot->isOver = game->isOver();
+    snapshot->firstWins = game->firstWins();
+    snapshot->secondWins = game->secondWins();
+    snapshot->movesMade = game->movesMade();
+    snapshot->piecesPerPlayer = game->piecesPerPlayer();
+    snapshot->firstScore = game->firstScore();
+    snapshot->secondScore = game->secondScore();
+    copyWords(game->firstBoard(), snapshot->firstBoard);
+    copyWords(game->secondBoard(), snapshot->secondBoard);
+    copyWords(game->neutralBoard(), snapshot->neutralBoard);
+    copyWords(game->legalBoard(), snapshot->legalBoard);
+}
 
 void *create(unsigned char size) {
-    return (void *) new BitsetOneToOneGame(size);
+    MOSAICGAME_LATENCY();
+    return createGame(size);
+}
+
+void *createWithBackend(unsigned char size, const char *backend) {
+    MOSAICGAME_LATENCY();
+    std::string name = backend == nullptr ? "bitset" : backend;
+    try {
+        if (name == "bitset") {
+            return createGame(size);
+        }
+        if (name == "word") {
+            return size < 1 ? nullptr : anyGameHandle(new AnyOneToOneGame(WordGame(size)));
+        }
+#ifdef MOSAICGAME_WITH_GMP
+        if (name == "gmp") {
+            return size < 1 ? nullptr : anyGameHandle(new AnyOneToOneGame(GMPOneToOneGame(size)));
+        }
+#endif
+    } catch (const std::exception &) {
+        return nullptr;
+    }
+    return nullptr;
 }
 
 void destroy(void *gamePointer) {
-    delete (BitsetOneToOneGame *) gamePointer;
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [](auto &game) {
+        if constexpr (isBitsetGame<decltype(game)>) {
+            BitsetGamePool::release(&game);
+        } else {
+            delete &game;
+        }
+    });
+}
+
+void *cloneGame(void *gamePointer) {
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        if constexpr (isBitsetGame<decltype(game)>) {
+            return (void *) BitsetGamePool::acquire(game);
+        } else {
+            return anyGameHandle(new AnyOneToOneGame(game));
+        }
+    });
+}
+
+bool resetGame(void *gamePointer, unsigned char size) {
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [size](auto &game) {
+        if (size < 1 || (isBitsetGame<decltype(game)> && size > BitsetBoard::MaxSize)) {
+            return false;
+        }
+        try {
+            game.reset(size);
+        } catch (const std::exception &) {
+            // The word backend throws above its largest size and keeps the game it had.
+            return false;
+        }
+        return true;
+    });
 }
 
 bool isOver(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->isOver();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.isOver();
+    });
 }
 
 bool firstWins(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->firstWins();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.firstWins();
+    });
 }
 
 bool secondWins(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->secondWins();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.secondWins();
+    });
 }
 
 bool isFirstTurn(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->isFirstTurn();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.isFirstTurn();
+    });
 }
 
 bool isSecondTurn(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->isSecondTurn();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.isSecondTurn();
+    });
 }
 
 bool playerWins(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->playerWins();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.playerWins();
+    });
 }
 
 bool opponentWins(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->opponentWins();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.opponentWins();
+    });
 }
 
 bool isLegalMove(void *gamePointer, unsigned int offset) {
-    return ((BitsetOneToOneGame *) gamePointer)->isLegalMove(BitsetMove(offset));
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [offset](auto &game) {
+        if (isBitsetGame<decltype(game)> && offset >= MosaicGame::Board::pyramidCells(BitsetBoard::MaxSize)) {
+            return false;
+        }
+        return game.isLegalMove(gameMove(game, offset));
+    });
 }
 
 unsigned short movesMade(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->movesMade();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.movesMade();
+    });
 }
 
 unsigned int getMove(void *gamePointer, unsigned short moveIndex) {
-    return ((BitsetOneToOneGame *) gamePointer)->moves()[moveIndex].toOffset();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [moveIndex](auto &game) {
+        return moveOffset(game.moves()[moveIndex]);
+    });
 }
 
 unsigned short piecesPerPlayer(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->piecesPerPlayer();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.piecesPerPlayer();
+    });
 }
 
 unsigned short firstScore(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->firstScore();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.firstScore();
+    });
 }
 
 unsigned short secondScore(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->secondScore();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.secondScore();
+    });
 }
 
 unsigned short playerScore(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->playerScore();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.playerScore();
+    });
 }
 
 unsigned short opponentScore(void *gamePointer) {
-    return ((BitsetOneToOneGame *) gamePointer)->opponentScore();
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return game.opponentScore();
+    });
 }
 
 void copyFirstBoard(void *gamePointer, char *returnPointer) {
-    strcpy(returnPointer, ((BitsetOneToOneGame *) gamePointer)->firstBoard().toString().c_str());
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [returnPointer](auto &game) {
+        strcpy(returnPointer, boardString(game.firstBoard()).c_str());
+    });
 }
 
 void copySecondBoard(void *gamePointer, char *returnPointer) {
-    strcpy(returnPointer, ((BitsetOneToOneGame *) gamePointer)->secondBoard().toString().c_str());
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [returnPointer](auto &game) {
+        strcpy(returnPointer, boardString(game.secondBoard()).c_str());
+    });
 }
 
 void copyPlayerBoard(void *gamePointer, char *returnPointer) {
-    strcpy(returnPointer, ((BitsetOneToOneGame *) gamePointer)->playerBoard().toString().c_str());
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [returnPointer](auto &game) {
+        strcpy(returnPointer, boardString(game.playerBoard()).c_str());
+    });
 }
 
 void copyOpponentBoard(void *gamePointer, char *returnPointer) {
-    strcpy(returnPointer, ((BitsetOneToOneGame *) gamePointer)->opponentBoard().toString().c_str());
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [returnPointer](auto &game) {
+        strcpy(returnPointer, boardString(game.opponentBoard()).c_str());
+    });
 }
 
 void copyNeutralBoard(void *gamePointer, char *returnPointer) {
-    strcpy(returnPointer, ((BitsetOneToOneGame *) gamePointer)->neutralBoard().toString().c_str());
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [returnPointer](auto &game) {
+        strcpy(returnPointer, boardString(game.neutralBoard()).c_str());
+    });
 }
 
 void copyLegalBoard(void *gamePointer, char *returnPointer) {
-    strcpy(returnPointer, ((BitsetOneToOneGame *) gamePointer)->legalBoard().toString().c_str());
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [returnPointer](auto &game) {
+        strcpy(returnPointer, boardString(game.legalBoard()).c_str());
+    });
+}
+
+void copyFirstBoardWords(void *gamePointer, uint64_t *words) {
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [words](auto &game) {
+        copyWords(game.firstBoard(), words);
+    });
+}
+
+void copySecondBoardWords(void *gamePointer, uint64_t *words) {
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [words](auto &game) {
+        copyWords(game.secondBoard(), words);
+    });
+}
+
+void copyPlayerBoardWords(void *gamePointer, uint64_t *words) {
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [words](auto &game) {
+        copyWords(game.playerBoard(), words);
+    });
+}
+
+void copyOpponentBoardWords(void *gamePointer, uint64_t *words) {
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [words](auto &game) {
+        copyWords(game.opponentBoard(), words);
+    });
+}
+
+void copyNeutralBoardWords(void *gamePointer, uint64_t *words) {
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [words](auto &game) {
+        copyWords(game.neutralBoard(), words);
+    });
+}
+
+void copyLegalBoardWords(void *gamePointer, uint64_t *words) {
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [words](auto &game) {
+        copyWords(game.legalBoard(), words);
+    });
+}
+
+size_t copyLegalMoves(void *gamePointer, uint8_t *offsets, size_t capacity) {
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [offsets, capacity](auto &game) {
+        if constexpr (isBitsetGame<decltype(game)>) {
+            return copyOffsets(game.legalBoard(), offsets, capacity);
+        } else {
+            if (MosaicGame::Board::pyramidCells(game.size()) > UINT8_MAX + 1) {
+                return (size_t) 0;
+            }
+            return copyOffsets(game.legalMoves(), offsets, capacity);
+        }
+    });
+}
+
+size_t copyLegalMoves32(void *gamePointer, uint32_t *offsets, size_t capacity) {
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [offsets, capacity](auto &game) {
+        if constexpr (isBitsetGame<decltype(game)>) {
+            return copyOffsets(game.legalBoard(), offsets, capacity);
+        } else {
+            return copyOffsets(game.legalMoves(), offsets, capacity);
+        }
+    });
+}
+
+bool makeMove(void *gamePointer, unsigned int offset) {
+    MOSAICGAME_LATENCY();
+    // The game classes throw on an illegal move, which must not cross the C boundary.
+    return makeGameMove(gamePointer, offset) == MOSAIC_OK;
+}
+
+MosaicStatus tryMakeMove(void *gamePointer, unsigned int offset) {
+    MOSAICGAME_LATENCY();
+    return makeGameMove(gamePointer, offset);
+}
+
+MosaicStatus tryUndo(void *gamePointer) {
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return (MosaicStatus) game.tryUndo();
+    });
+}
+
+MosaicStatus tryRedo(void *gamePointer) {
+    MOSAICGAME_LATENCY();
+    return dispatch(gamePointer, [](auto &game) {
+        return (MosaicStatus) game.tryRedo();
+    });
+}
+
+size_t makeMoves(void *gamePointer, const uint32_t *offsets, size_t count, MosaicSnapshot *snapshot) {
+    MOSAICGAME_LATENCY();
+    auto made = dispatch(gamePointer, [offsets, count](auto &game) {
+        size_t made = 0;
+        while (made < count && game.tryMakeMove(gameMove(game, offsets[made])) == GameStatus::Ok) {
+            made++;
+        }
+        return made;
+    });
+    if (snapshot != nullptr) {
+        writeSnapshot(gamePointer, snapshot);
+    }
+    return made;
 }
 
-void makeMove(void *gamePointer, unsigned int offset) {
-    ((BitsetOneToOneGame *) gamePointer)->makeMove(BitsetMove(offset));
+void getSnapshot(void *gamePointer, MosaicSnapshot *snapshot) {
+    MOSAICGAME_LATENCY();
+    writeSnapshot(gamePointer, snapshot);
 }
 
 void flipVertical(void *gamePointer) {
-    ((BitsetOneToOneGame *) gamePointer)->flipVertical();
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [](auto &game) {
+        game.flipVertical();
+    });
 }
 
 void mirrorHorizontal(void *gamePointer) {
-    ((BitsetOneToOneGame *) gamePointer)->mirrorHorizontal();
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [](auto &game) {
+        game.mirrorHorizontal();
+    });
 }
 
 void flipDiagonal(void *gamePointer) {
-    ((BitsetOneToOneGame *) gamePointer)->flipDiagonal();
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [](auto &game) {
+        game.flipDiagonal();
+    });
 }
 
 void rotate90(void *gamePointer) {
-    ((BitsetOneToOneGame *) gamePointer)->rotate90();
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [](auto &game) {
+        game.rotate90();
+    });
 }
 
 void rotate180(void *gamePointer) {
-    ((BitsetOneToOneGame *) gamePointer)->rotate180();
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [](auto &game) {
+        game.rotate180();
+    });
 }
 
 void rotate270(void *gamePointer) {
-    ((BitsetOneToOneGame *) gamePointer)->rotate270();
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [](auto &game) {
+        game.rotate270();
+    });
 }
 
 void transform(void *gamePointer) {
-    ((BitsetOneToOneGame *) gamePointer)->transform();
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [](auto &game) {
+        game.transform();
+    });
 }
 
 void resetTransformation(void *gamePointer) {
-    ((BitsetOneToOneGame *) gamePointer)->resetTransformation();
+    MOSAICGAME_LATENCY();
+    dispatch(gamePointer, [](auto &game) {
+        game.resetTransformation();
+    });
+}
+
+void *openBook(const char *path) {
+    MOSAICGAME_LATENCY();
+    try {
+        return (void *) new BitsetOpeningBook(path);
+    } catch (const std::exception &) {
+        return nullptr;
+    }
+}
+
+void closeBook(void *bookPointer) {
+    MOSAICGAME_LATENCY();
+    delete (BitsetOpeningBook *) bookPointer;
+}
+
+unsigned int lookupBook(void *bookPointer, void *gamePointer, unsigned int *offsets, unsigned int *weights,
+                        unsigned int capacity) {
+    MOSAICGAME_LATENCY();
+    auto game = bitsetGame(gamePointer);
+    if (game == nullptr) {
+        return 0;
+    }
+    auto candidates = ((BitsetOpeningBook *) bookPointer)->lookup(game->position());
+    for (unsigned int i = 0; i < candidates.size() && i < capacity; i++) {
+        offsets[i] = candidates[i].move.toOffset();
+        weights[i] = candidates[i].weight;
+    }
+    return candidates.size();
+}
+
+void *startSearch(void *gamePointer, const char *engine, uint64_t seed, uint32_t timeLimitMilliseconds) {
+    MOSAICGAME_LATENCY();
+    auto game = bitsetGame(gamePointer);
+    if (game == nullptr) {
+        return nullptr;
+    }
+    auto position = game->position();
+    if (position.isOver()) {
+        return nullptr;
+    }
+    try {
+        return (void *) new BitsetAsyncSearch(BitsetEngineFactory::create(engine), position, seed,
+                                              std::chrono::milliseconds(timeLimitMilliseconds));
+    } catch (const std::exception &) {
+        return nullptr;
+    }
+}
+
+void pollSearch(void *searchPointer, MosaicSearchProgress *progress) {
+    MOSAICGAME_LATENCY();
+    auto search = (BitsetAsyncSearch *) searchPointer;
+    auto current = search->progress();
+    progress->done = search->isDone();
+    progress->depth = current.depth;
+    progress->iterations = current.iterations;
+    progress->nodes = current.nodes;
+    progress->bestMove = current.bestMove.has_value() ? (int32_t) current.bestMove->toOffset() : -1;
+}
+
+void cancelSearch(void *searchPointer) {
+    MOSAICGAME_LATENCY();
+    ((BitsetAsyncSearch *) searchPointer)->cancel();
+}
+
+void extendSearch(void *searchPointer, uint32_t milliseconds) {
+    MOSAICGAME_LATENCY();
+    ((BitsetAsyncSearch *) searchPointer)->extendDeadline(std::chrono::milliseconds(milliseconds));
+}
+
+int32_t waitSearch(void *searchPointer) {
+    MOSAICGAME_LATENCY();
+    try {
+        return (int32_t) ((BitsetAsyncSearch *) searchPointer)->wait().bestMove.toOffset();
+    } catch (const std::exception &) {
+        return -1;
+    }
+}
+
+void destroySearch(void *searchPointer) {
+    MOSAICGAME_LATENCY();
+    delete (BitsetAsyncSearch *) searchPointer;
+}
+
+uint32_t cellCount(unsigned char size) {
+    MOSAICGAME_LATENCY();
+    return MosaicGame::Board::pyramidCells(size);
+}
+
+bool offsetToCell(unsigned char size, unsigned int offset, MosaicCell *cell) {
+    MOSAICGAME_LATENCY();
+    if (offset >= MosaicGame::Board::pyramidCells(size)) {
+        return false;
+    }
+    auto coordinate = offset < BitsetCellGeometry::CellCount
+                      ? BitsetCellGeometry::cell(offset).coordinate
+                      : MosaicGame::Board::offsetToCoordinate(offset);
+    *cell = MosaicCell{coordinate.layer, coordinate.row, coordinate.column};
+    return true;
+}
+
+int32_t cellToOffset(unsigned char size, const MosaicCell *cell) {
+    MOSAICGAME_LATENCY();
+    auto coordinate = CellCoordinate{cell->layer, cell->row, cell->column};
+    if (!MosaicGame::Board::pyramidContains(size, coordinate)) {
+        return -1;
+    }
+    return (int32_t) MosaicGame::Board::coordinateToOffset(coordinate);
+}
+
+size_t copyCellSupports(unsigned char size, unsigned int offset, uint32_t *offsets) {
+    MOSAICGAME_LATENCY();
+    if (size > BitsetCellGeometry::MaxSize || offset >= MosaicGame::Board::pyramidCells(size)) {
+        return 0;
+    }
+    auto count = BitsetCellGeometry::supportCount(size, offset);
+    std::copy_n(BitsetCellGeometry::cell(offset).supports.begin(), count, offsets);
+    return count;
+}
+
+size_t copyCellParents(unsigned char size, unsigned int offset, uint32_t *offsets) {
+    MOSAICGAME_LATENCY();
+    if (size > BitsetCellGeometry::MaxSize || offset >= MosaicGame::Board::pyramidCells(size)) {
+        return 0;
+    }
+    const auto &cell = BitsetCellGeometry::cell(offset);
+    std::copy_n(cell.parents.begin(), cell.parentCount, offsets);
+    return cell.parentCount;
+}
+
+size_t featurePlanesLength(unsigned char size) {
+    MOSAICGAME_LATENCY();
+    return BitsetFeaturePlanes::length(size);
+}
+
+// Games of other backends have no feature planes; their slice is zeroed so that a batch holds no stale data.
+template<typename T>
+static bool writeGamePlanes(void *gamePointer, T *buffer) {
+    return dispatch(gamePointer, [buffer](auto &game) {
+        if constexpr (isBitsetGame<decltype(game)>) {
+            BitsetFeaturePlanes::write(game.position(), buffer);
+            return true;
+        } else {
+            std::fill(buffer, buffer + BitsetFeaturePlanes::length(game.size()), T(0));
+            return false;
+        }
+    });
+}
+
+template<typename T>
+static size_t writeGamesPlanes(void **gamePointers, size_t count, T *buffer) {
+    size_t written = 0;
+    for (size_t i = 0; i < count; i++) {
+        written += writeGamePlanes(gamePointers[i], buffer) ? 1 : 0;
+        buffer += BitsetFeaturePlanes::length(dispatch(gamePointers[i], [](auto &game) {
+            return game.size();
+        }));
+    }
+    return written;
+}
+
+bool writeFeaturePlanes(void *gamePointer, uint8_t *buffer) {
+    MOSAICGAME_LATENCY();
+    return writeGamePlanes(gamePointer, buffer);
+}
+
+bool writeFeaturePlanesFloat(void *gamePointer, float *buffer) {
+    MOSAICGAME_LATENCY();
+    return writeGamePlanes(gamePointer, buffer);
+}
+
+size_t writeFeaturePlanesBatch(void **gamePointers, size_t count, uint8_t *buffer) {
+    MOSAICGAME_LATENCY();
+    return writeGamesPlanes(gamePointers, count, buffer);
+}
+
+size_t writeFeaturePlanesBatchFloat(void **gamePointers, size_t count, float *buffer) {
+    MOSAICGAME_LATENCY();
+    return writeGamesPlanes(gamePointers, count, buffer);
+}
+
+size_t selfPlay(unsigned char size, size_t games, unsigned int threads, uint64_t seed, const char *engine,
+                const char *outputPrefix) {
+    MOSAICGAME_LATENCY();
+    BitsetSelfPlayConfiguration configuration = {};
+    configuration.size = size;
+    configuration.games = games;
+    configuration.threads = threads;
+    configuration.seed = seed;
+    configuration.firstEngine = engine;
+    configuration.outputPrefix = outputPrefix;
+    try {
+        return BitsetSelfPlay(configuration).run();
+    } catch (const std::exception &) {
+        return 0;
+    }
+}
+
+void *openRecordWriter(const char *path, unsigned int gamesPerBlock) {
+    MOSAICGAME_LATENCY();
+    try {
+        return (void *) new BitsetGameRecordWriter(path, gamesPerBlock);
+    } catch (const std::exception &) {
+        return nullptr;
+    }
+}
+
+bool writeRecordGame(void *writerPointer, void *gamePointer, const char *metadata) {
+    MOSAICGAME_LATENCY();
+    auto game = bitsetGame(gamePointer);
+    if (game == nullptr) {
+        return false;
+    }
+    BitsetGameRecord record = {};
+    record.size = game->size();
+    for (const auto &move : game->moves()) {
+        record.moves.emplace_back(move.toOffset());
+    }
+    if (game->firstWins()) {
+        record.result = BitsetGameRecord::FirstWins;
+    } else if (game->secondWins()) {
+        record.result = BitsetGameRecord::SecondWins;
+    } else {
+        record.result = BitsetGameRecord::Unfinished;
+    }
+    if (metadata != nullptr) {
+        record.metadata = metadata;
+    }
+    try {
+        ((BitsetGameRecordWriter *) writerPointer)->write(record);
+        return true;
+    } catch (const std::exception &) {
+        return false;
+    }
+}
+
+bool closeRecordWriter(void *writerPointer) {
+    MOSAICGAME_LATENCY();
+    auto writer = (BitsetGameRecordWriter *) writerPointer;
+    auto closed = true;
+    try {
+        writer->close();
+    } catch (const std::exception &) {
+        closed = false;
+    }
+    delete writer;
+    return closed;
+}
+
+void *openRecordReader(const char *path) {
+    MOSAICGAME_LATENCY();
+    try {
+        return (void *) new BitsetGameRecordReader(path);
+    } catch (const std::exception &) {
+        return nullptr;
+    }
+}
+
+void closeRecordReader(void *readerPointer) {
+    MOSAICGAME_LATENCY();
+    delete (BitsetGameRecordReader *) readerPointer;
+}
+
+uint64_t recordGames(void *readerPointer) {
+    MOSAICGAME_LATENCY();
+    return ((BitsetGameRecordReader *) readerPointer)->games();
+}
+
+size_t readRecordMoves(void *readerPointer, uint64_t game, unsigned char *size, uint8_t *moves, size_t capacity) {
+    MOSAICGAME_LATENCY();
+    BitsetGameRecord record = {};
+    try {
+        record = ((BitsetGameRecordReader *) readerPointer)->read(game);
+    } catch (const std::exception &) {
+        *size = 0;
+        return 0;
+    }
+    *size = record.size;
+    for (size_t i = 0; i < record.moves.size() && i < capacity; i++) {
+        moves[i] = record.moves[i];
+    }
+    return record.moves.size();
+}
+
+void validateGames(unsigned char size, const uint8_t *moves, const size_t *lengths, size_t games, unsigned int threads,
+                   MosaicGameReport *reports) {
+    MOSAICGAME_LATENCY();
+    std::vector<size_t> offsets(games + 1, 0);
+    for (size_t i = 0; i < games; i++) {
+        offsets[i + 1] = offsets[i] + lengths[i];
+    }
+    WorkStealingPool(threads).run(games, [size, moves, lengths, reports, &offsets](size_t game, unsigned int) {
+        auto report = BitsetGameValidator::validate(size, moves + offsets[game], lengths[game]);
+        reports[game] = {
+                report.status,
+                report.over,
+                report.movesMade,
+                report.firstScore,
+                report.secondScore,
+                report.chainMoves,
+                report.chainedPieces,
+                report.longestChain,
+        };
+    });
+}
+
+size_t dumpInstrumentation(char *buffer, size_t capacity) {
+    auto snapshot = Instrumentation::snapshot();
+    if (capacity > 0) {
+        auto length = std::min(snapshot.size(), capacity - 1);
+        std::memcpy(buffer, snapshot.data(), length);
+        buffer[length] = '\0';
+    }
+    return snapshot.size();
+}
+
+void resetInstrumentation() {
+    Instrumentation::reset();
+}
+
+void startTrace() {
+    Tracer::start();
+}
+
+void stopTrace() {
+    Tracer::stop();
+}
+
+bool writeTrace(const char *path) {
+    try {
+        Tracer::write(path);
+        return true;
+    } catch (const std::exception &) {
+        return false;
+    }
 }
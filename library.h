@@ -1,12 +1,77 @@
 #ifndef MOSAICGAME_LIBRARY_H
 #define MOSAICGAME_LIBRARY_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define MOSAIC_BOARD_WORDS 3
+
+typedef enum MosaicStatus {
+    MOSAIC_OK = 0,
+    MOSAIC_GAME_OVER = 1,
+    MOSAIC_ILLEGAL_MOVE = 2,
+    MOSAIC_NOT_UNDOABLE = 3,
+    MOSAIC_NOT_REDOABLE = 4,
+} MosaicStatus;
+
+typedef struct MosaicSnapshot {
+    uint8_t size;
+    bool isFirstTurn;
+    bool isOver;
+    bool firstWins;
+    bool secondWins;
+    uint16_t movesMade;
+    uint16_t piecesPerPlayer;
+    uint16_t firstScore;
+    uint16_t secondScore;
+    uint64_t firstBoard[MOSAIC_BOARD_WORDS];
+    uint64_t secondBoard[MOSAIC_BOARD_WORDS];
+    uint64_t neutralBoard[MOSAIC_BOARD_WORDS];
+    uint64_t legalBoard[MOSAIC_BOARD_WORDS];
+} MosaicSnapshot;
+
+typedef struct MosaicSearchProgress {
+    bool done;
+    // Plies of the deepest line examined so far; for Monte Carlo, the longest playout including its first move.
+    uint32_t depth;
+    uint32_t iterations;
+    uint64_t nodes;
+    int32_t bestMove;
+} MosaicSearchProgress;
+
+typedef struct MosaicGameReport {
+    uint8_t status;
+    bool over;
+    uint32_t movesMade;
+    uint16_t firstScore;
+    uint16_t secondScore;
+    uint16_t chainMoves;
+    uint16_t chainedPieces;
+    uint16_t longestChain;
+} MosaicGameReport;
+
+// Layer 0 is the apex and layer k is k + 1 cells wide; rows and columns count from 0 within the layer.
+typedef struct MosaicCell {
+    uint8_t layer;
+    uint8_t row;
+    uint8_t column;
+} MosaicCell;
+
+// Returns NULL for a size of 0 or above 7, the largest bitset board.
 void *create(unsigned char size);
+// "bitset" is the create() backend. "word" takes sizes up to 12 and "gmp", built when GMP is installed, any size.
+// Returns NULL for an unknown or unavailable backend or an unsupported size. Books, searches, feature planes and
+// records need a bitset game and skip others; board words and snapshots hold only the first MOSAIC_BOARD_WORDS * 64
+// cells.
+void *createWithBackend(unsigned char size, const char *backend);
 void destroy(void *gamePointer);
+void *cloneGame(void *gamePointer);
+// Returns false and leaves the game as it was for a size its backend does not support.
+bool resetGame(void *gamePointer, unsigned char size);
 bool isFirstTurn(void *gamePointer);
 bool isSecondTurn(void *gamePointer);
 bool firstWins(void *gamePointer);
@@ -22,13 +87,31 @@ unsigned short firstScore(void *gamePointer);
 unsigned short secondScore(void *gamePointer);
 unsigned short playerScore(void *gamePointer);
 unsigned short opponentScore(void *gamePointer);
+// Board strings hold one character per cell plus the terminator, so the buffer needs cellCount(size) + 1 bytes:
+// 141 for bitset games, more for larger sizes of other backends.
 void copyPlayerBoard(void *gamePointer, char *returnPointer);
 void copyOpponentBoard(void *gamePointer, char *returnPointer);
 void copyFirstBoard(void *gamePointer, char *returnPointer);
 void copySecondBoard(void *gamePointer, char *returnPointer);
 void copyNeutralBoard(void *gamePointer, char *returnPointer);
 void copyLegalBoard(void *gamePointer, char *returnPointer);
-void makeMove(void *gamePointer, unsigned int offset);
+void copyPlayerBoardWords(void *gamePointer, uint64_t *words);
+void copyOpponentBoardWords(void *gamePointer, uint64_t *words);
+void copyFirstBoardWords(void *gamePointer, uint64_t *words);
+void copySecondBoardWords(void *gamePointer, uint64_t *words);
+void copyNeutralBoardWords(void *gamePointer, uint64_t *words);
+void copyLegalBoardWords(void *gamePointer, uint64_t *words);
+// Returns 0 when the game's offsets do not fit in uint8_t (sizes 9 and up); use copyLegalMoves32 for those.
+size_t copyLegalMoves(void *gamePointer, uint8_t *offsets, size_t capacity);
+size_t copyLegalMoves32(void *gamePointer, uint32_t *offsets, size_t capacity);
+// Returns false and leaves the game unchanged for a move that is illegal, out of range or made after the game is
+// over; tryMakeMove reports which.
+bool makeMove(void *gamePointer, unsigned int offset);
+MosaicStatus tryMakeMove(void *gamePointer, unsigned int offset);
+MosaicStatus tryUndo(void *gamePointer);
+MosaicStatus tryRedo(void *gamePointer);
+size_t makeMoves(void *gamePointer, const uint32_t *offsets, size_t count, MosaicSnapshot *snapshot);
+void getSnapshot(void *gamePointer, MosaicSnapshot *snapshot);
 void flipVertical(void *gamePointer);
 void mirrorHorizontal(void *gamePointer);
 void flipDiagonal(void *gamePointer);
@@ -37,6 +120,52 @@ void rotate180(void *gamePointer);
 void rotate270(void *gamePointer);
 void transform(void *gamePointer);
 void resetTransformation(void *gamePointer);
+// Returns NULL when the file is missing, truncated or malformed.
+void *openBook(const char *path);
+void closeBook(void *bookPointer);
+unsigned int lookupBook(void *bookPointer, void *gamePointer, unsigned int *offsets, unsigned int *weights,
+                        unsigned int capacity);
+void *startSearch(void *gamePointer, const char *engine, uint64_t seed, uint32_t timeLimitMilliseconds);
+void pollSearch(void *searchPointer, MosaicSearchProgress *progress);
+void cancelSearch(void *searchPointer);
+void extendSearch(void *searchPointer, uint32_t milliseconds);
+int32_t waitSearch(void *searchPointer);
+void destroySearch(void *searchPointer);
+// Offsets do not depend on the size, which only bounds them. The conversions take any size; the neighbourhood
+// functions write up to 4 offsets, read from tables covering sizes up to 7, and return 0 for larger sizes.
+uint32_t cellCount(unsigned char size);
+bool offsetToCell(unsigned char size, unsigned int offset, MosaicCell *cell);
+int32_t cellToOffset(unsigned char size, const MosaicCell *cell);
+size_t copyCellSupports(unsigned char size, unsigned int offset, uint32_t *offsets);
+size_t copyCellParents(unsigned char size, unsigned int offset, uint32_t *offsets);
+size_t featurePlanesLength(unsigned char size);
+// Games that are not bitset games get featurePlanesLength(size) zeros. The single-game functions return whether
+// planes were written, the batch ones how many games had planes written.
+bool writeFeaturePlanes(void *gamePointer, uint8_t *buffer);
+bool writeFeaturePlanesFloat(void *gamePointer, float *buffer);
+size_t writeFeaturePlanesBatch(void **gamePointers, size_t count, uint8_t *buffer);
+size_t writeFeaturePlanesBatchFloat(void **gamePointers, size_t count, float *buffer);
+// Returns the number of games written, or 0 when an engine is unknown or a shard cannot be written.
+size_t selfPlay(unsigned char size, size_t games, unsigned int threads, uint64_t seed, const char *engine,
+                const char *outputPrefix);
+// The writer functions return NULL or false when the file cannot be written, and writeRecordGame also for a game
+// that is not a bitset game. closeRecordWriter frees the writer either way.
+void *openRecordWriter(const char *path, unsigned int gamesPerBlock);
+bool writeRecordGame(void *writerPointer, void *gamePointer, const char *metadata);
+bool closeRecordWriter(void *writerPointer);
+// Returns NULL when the file is missing, truncated or malformed.
+void *openRecordReader(const char *path);
+void closeRecordReader(void *readerPointer);
+uint64_t recordGames(void *readerPointer);
+// Sets *size to 0 and returns 0 when the game is out of range or its block is corrupt.
+size_t readRecordMoves(void *readerPointer, uint64_t game, unsigned char *size, uint8_t *moves, size_t capacity);
+void validateGames(unsigned char size, const uint8_t *moves, const size_t *lengths, size_t games, unsigned int threads,
+                   MosaicGameReport *reports);
+size_t dumpInstrumentation(char *buffer, size_t capacity);
+void resetInstrumentation(void);
+void startTrace(void);
+void stopTrace(void);
+bool writeTrace(const char *path);
 
 #ifdef __cplusplus
 }
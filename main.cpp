@@ -1,26 +1,31 @@
-#include <chrono>
 #include <iostream>
 
+#include "Benchmark/BenchmarkSuite.h"
 #include "Game/BitsetOneToOneGame.h"
-//#include "Game/GMPOneToOneGame.h"
 
+using MosaicGame::Benchmark::BenchmarkOptions;
+using MosaicGame::Benchmark::BenchmarkSuite;
+using MosaicGame::Benchmark::doNotOptimize;
 using MosaicGame::Game::BitsetOneToOneGame;
-//using MosaicGame::Game::GMPOneToOneGame;
 
+// Plays size-7 games with the first legal move to the end; bench covers the rest of the library.
 int main() {
-    auto start = std::chrono::system_clock::now();
-    for (auto i = 0; i < 100; i++) {
-        auto game = BitsetOneToOneGame(7);
-        while (!game.isOver()) {
-            auto legalMoves = game.legalMoves();
-            game.makeMove(legalMoves[0]);
+    BenchmarkSuite suite = {};
+    suite.add("game.firstMove.size7", [](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; i++) {
+            auto game = BitsetOneToOneGame(7);
+            while (!game.isOver()) {
+                auto legalMoves = game.legalMoves();
+                game.makeMove(legalMoves[0]);
+            }
+            doNotOptimize(game.firstScore());
         }
-    }
+    });
 
-    auto end = std::chrono::system_clock::now();
-    auto duration = end - start;
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
-    std::cout << ms / (double)1000 << " seconds" << std::endl;
+    for (const auto &result: suite.run(BenchmarkOptions{})) {
+        std::cout << result.name << ": " << result.median / 1000000 << " ms per game (p99 "
+                  << result.p99 / 1000000 << " ms)" << std::endl;
+    }
 
     return 0;
 }
@@ -0,0 +1,63 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "Instrumentation/Tracer.h"
+#include "SelfPlay/BitsetSelfPlay.h"
+
+using MosaicGame::Instrumentation::Tracer;
+using MosaicGame::SelfPlay::BitsetSelfPlay;
+using MosaicGame::SelfPlay::BitsetSelfPlayConfiguration;
+
+int main(int argc, char **argv) {
+    BitsetSelfPlayConfiguration configuration = {};
+    std::string tracePath;
+    for (auto i = 1; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value = argv[i + 1];
+        if (option == "--size") {
+            configuration.size = std::stoul(value);
+        } else if (option == "--games") {
+            configuration.games = std::stoull(value);
+        } else if (option == "--threads") {
+            configuration.threads = std::stoul(value);
+        } else if (option == "--seed") {
+            configuration.seed = std::stoull(value);
+        } else if (option == "--engine") {
+            configuration.firstEngine = value;
+        } else if (option == "--opponent") {
+            configuration.secondEngine = value;
+        } else if (option == "--output") {
+            configuration.outputPrefix = value;
+        } else if (option == "--shard-games") {
+            configuration.gamesPerShard = std::stoull(value);
+        } else if (option == "--flush-games") {
+            configuration.flushGames = std::stoull(value);
+        } else if (option == "--trace") {
+            tracePath = value;
+        } else {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return 1;
+        }
+    }
+    if (argc % 2 == 0) {
+        std::cerr << "Usage: selfplay [--size N] [--games N] [--threads N] [--seed N] [--engine SPEC]"
+                  << " [--opponent SPEC] [--output PREFIX] [--shard-games N] [--flush-games N] [--trace PATH]"
+                  << std::endl;
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (!tracePath.empty()) {
+        Tracer::start();
+    }
+    auto games = BitsetSelfPlay(configuration).run();
+    if (!tracePath.empty()) {
+        Tracer::stop();
+        Tracer::write(tracePath);
+    }
+    auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << games << " games in " << seconds << " seconds (" << games / seconds << " games/s)" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "Instrumentation/Tracer.h"
+#include "Tournament/BitsetTournament.h"
+
+using MosaicGame::Instrumentation::Tracer;
+using MosaicGame::Tournament::BitsetTournament;
+using MosaicGame::Tournament::BitsetTournamentConfiguration;
+using MosaicGame::Tournament::BitsetTournamentResult;
+
+int main(int argc, char **argv) {
+    BitsetTournamentConfiguration configuration = {};
+    std::string tracePath;
+    for (auto i = 1; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value = argv[i + 1];
+        if (option == "--size") {
+            configuration.size = std::stoul(value);
+        } else if (option == "--candidate") {
+            configuration.candidateEngine = value;
+        } else if (option == "--baseline") {
+            configuration.baselineEngine = value;
+        } else if (option == "--pairs") {
+            configuration.pairs = std::stoull(value);
+        } else if (option == "--threads") {
+            configuration.threads = std::stoul(value);
+        } else if (option == "--seed") {
+            configuration.seed = std::stoull(value);
+        } else if (option == "--opening-plies") {
+            configuration.openingPlies = std::stoul(value);
+        } else if (option == "--tc") {
+            auto separator = value.find('+');
+            configuration.baseTime = std::chrono::milliseconds(std::stoull(value.substr(0, separator)));
+            if (separator != std::string::npos) {
+                configuration.increment = std::chrono::milliseconds(std::stoull(value.substr(separator + 1)));
+            }
+        } else if (option == "--sprt") {
+            auto separator = value.find(',');
+            configuration.sprt = true;
+            configuration.elo0 = std::stod(value.substr(0, separator));
+            configuration.elo1 = std::stod(value.substr(separator + 1));
+        } else if (option == "--alpha") {
+            configuration.alpha = std::stod(value);
+        } else if (option == "--beta") {
+            configuration.beta = std::stod(value);
+        } else if (option == "--trace") {
+            tracePath = value;
+        } else {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return 1;
+        }
+    }
+    if (argc % 2 == 0) {
+        std::cerr << "Usage: tournament [--size N] [--candidate SPEC] [--baseline SPEC] [--pairs N] [--threads N]"
+                  << " [--seed N] [--opening-plies N] [--tc BASE_MS[+INCREMENT_MS]] [--sprt ELO0,ELO1]"
+                  << " [--alpha A] [--beta B] [--trace PATH]" << std::endl;
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (!tracePath.empty()) {
+        Tracer::start();
+    }
+    auto result = BitsetTournament(configuration).run();
+    if (!tracePath.empty()) {
+        Tracer::stop();
+        Tracer::write(tracePath);
+    }
+    auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const auto &statistics = result.statistics;
+    auto [lower, upper] = statistics.eloInterval(1.96);
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << configuration.candidateEngine << " vs " << configuration.baselineEngine << ": "
+              << statistics.pairs() << " pairs from " << result.openings << " openings in " << seconds
+              << " seconds" << std::endl;
+    std::cout << "Games +" << result.candidateWins << " -" << result.baselineWins
+              << ", pairs 2:" << statistics.pairs(2) << " 1:" << statistics.pairs(1) << " 0:" << statistics.pairs(0)
+              << ", time losses " << result.timeLosses << std::endl;
+    std::cout << "Score " << std::setprecision(3) << statistics.score() << std::setprecision(1)
+              << ", Elo " << statistics.elo() << " [" << lower << ", " << upper << "] (95%)" << std::endl;
+    if (configuration.sprt) {
+        static const char *decisions[] = {"undecided", "H0 accepted", "H1 accepted"};
+        std::cout << std::setprecision(2) << "SPRT [" << configuration.elo0 << ", " << configuration.elo1
+                  << "] LLR " << result.logLikelihoodRatio
+                  << " [" << std::log(configuration.beta / (1.0 - configuration.alpha))
+                  << ", " << std::log((1.0 - configuration.beta) / configuration.alpha) << "] "
+                  << decisions[result.decision] << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "Record/BitsetGameRecordReader.h"
+#include "Record/BitsetGameValidator.h"
+
+using MosaicGame::Record::BitsetGameRecordReader;
+using MosaicGame::Record::BitsetGameReport;
+using MosaicGame::Record::BitsetGameValidator;
+
+int main(int argc, char **argv) {
+    if (argc != 2 && argc != 4) {
+        std::cerr << "Usage: validate RECORD_FILE [--threads N]" << std::endl;
+        return 1;
+    }
+    unsigned int threads = 0;
+    if (argc == 4) {
+        if (std::string(argv[2]) != "--threads") {
+            std::cerr << "Unknown option: " << argv[2] << std::endl;
+            return 1;
+        }
+        threads = std::stoul(argv[3]);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto reader = BitsetGameRecordReader(argv[1]);
+    auto reports = BitsetGameValidator::validate(reader, threads);
+    auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    static const char *statuses[] = {"valid", "invalid_size", "illegal_move", "move_after_game_over"};
+    std::size_t invalid = 0;
+    std::cout << "game,status,over,moves,first_score,second_score,chain_moves,chained_pieces,longest_chain\n";
+    for (std::size_t i = 0; i < reports.size(); i++) {
+        const auto &report = reports[i];
+        invalid += report.status != BitsetGameReport::Valid;
+        std::cout << i << ',' << statuses[report.status] << ',' << report.over << ',' << report.movesMade << ','
+                  << report.firstScore << ',' << report.secondScore << ',' << report.chainMoves << ','
+                  << report.chainedPieces << ',' << report.longestChain << '\n';
+    }
+    std::cerr << reports.size() << " games, " << invalid << " invalid, " << seconds << " seconds" << std::endl;
+
+    return invalid == 0 ? 0 : 2;
+}